@@ -0,0 +1,217 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+// Measures the hot paths of the library on the synthetic libraries from test/synthetic_library.cmake.
+// Libraries must have at least one overloaded function, template instantiation and section symbol.
+//
+// Usage: benchmark [--min-time-ms=<milliseconds>] <synthetic library>...
+//
+// Prints a JSON object per line for each measurement:
+// {"benchmark":"shared_library_get","library":"synthetic_1000","symbols":1000,"iterations":1048576,"ns_per_op":21.4}
+
+#include <boost/dll/import.hpp>
+#include <boost/dll/library_info.hpp>
+#include <boost/dll/shared_library.hpp>
+#include <boost/dll/smart_library.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace dll = boost::dll;
+
+namespace {
+
+// Aliases for the classes of the synthetic library
+struct widget_alias {};
+struct holder_alias {};
+
+using clock_type = std::chrono::steady_clock;
+
+std::chrono::nanoseconds min_time = std::chrono::milliseconds(200);
+
+// Stops the compiler from optimizing away the measured code
+volatile std::uintptr_t sink = 0;
+
+template <class T>
+void consume(const T& value) {
+    sink = sink + static_cast<std::uintptr_t>(value);
+}
+
+struct library_under_test {
+    dll::fs::path   path;
+    std::string     name;
+
+    // Layout of the library, see test/synthetic_library.cmake
+    unsigned        symbols;
+    unsigned        namespace_size;
+    unsigned        overloaded;
+    unsigned        templates;
+};
+
+void report(const char* benchmark, const library_under_test& lib, std::size_t iterations, double ns_per_op) {
+    std::cout << "{\"benchmark\":\"" << benchmark
+        << "\",\"library\":\"" << lib.name
+        << "\",\"symbols\":" << lib.symbols
+        << ",\"iterations\":" << iterations
+        << ",\"ns_per_op\":" << ns_per_op
+        << "}" << std::endl;
+}
+
+// Doubles the iterations count until the measurement takes at least `min_time`
+template <class Function>
+void run(const char* benchmark, const library_under_test& lib, Function f) {
+    for (std::size_t iterations = 1;; iterations *= 2) {
+        const clock_type::time_point start = clock_type::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            f(i);
+        }
+        const clock_type::duration elapsed = clock_type::now() - start;
+
+        if (elapsed >= min_time) {
+            const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            report(benchmark, lib, iterations, ns / static_cast<double>(iterations));
+            return;
+        }
+    }
+}
+
+// Names of the C functions spread evenly over the library
+std::vector<std::string> c_function_names(const library_under_test& lib) {
+    const unsigned count = lib.symbols / 2;
+    const unsigned step = (count > 1024 ? count / 1024 : 1);
+
+    std::vector<std::string> names;
+    for (unsigned i = 0; i < count; i += step) {
+        names.push_back("synthetic_c_" + std::to_string(i));
+    }
+    return names;
+}
+
+void benchmark_library(const library_under_test& lib) {
+    run("library_info_parse", lib, [&lib](std::size_t) {
+        dll::library_info info(lib.path);
+        consume(info.symbols().size());
+    });
+
+    run("library_info_section_symbols", lib, [&lib](std::size_t) {
+        dll::library_info info(lib.path);
+        consume(info.symbols("synthsec").size());
+    });
+
+    // Measured before the library is kept loaded, so that each iteration maps the library
+    run("shared_library_load_unload", lib, [&lib](std::size_t) {
+        dll::shared_library loaded(lib.path);
+        consume(reinterpret_cast<std::uintptr_t>(loaded.native()));
+    });
+
+    const dll::shared_library loaded(lib.path);
+    const std::vector<std::string> names = c_function_names(lib);
+
+    run("shared_library_get", lib, [&loaded, &names](std::size_t i) {
+        consume(reinterpret_cast<std::uintptr_t>(&loaded.get<int(int)>(names[i % names.size()])));
+    });
+
+    run("shared_library_has", lib, [&loaded, &names](std::size_t i) {
+        consume(loaded.has(names[i % names.size()]));
+    });
+
+    run("shared_library_has_missing", lib, [&loaded](std::size_t) {
+        consume(loaded.has("synthetic_missing_symbol"));
+    });
+
+    int (&raw)(int) = loaded.get<int(int)>(names.front());
+    run("raw_call", lib, [&raw](std::size_t i) {
+        consume(raw(static_cast<int>(i)));
+    });
+
+    const auto imported = dll::import_symbol<int(int)>(loaded, names.front());
+    run("import_symbol_call", lib, [&imported](std::size_t i) {
+        consume(imported(static_cast<int>(i)));
+    });
+
+    run("import_symbol_copy", lib, [&imported](std::size_t i) {
+        const auto copy = imported;
+        consume(copy(static_cast<int>(i)));
+    });
+
+    run("import_symbol", lib, [&loaded, &names](std::size_t i) {
+        const auto f = dll::import_symbol<int(int)>(loaded, names[i % names.size()]);
+        consume(f(0));
+    });
+
+    run("smart_library_construct", lib, [&lib](std::size_t) {
+        dll::experimental::smart_library sl(lib.path);
+        consume(sl.symbol_storage().get_storage().size());
+    });
+
+    dll::experimental::smart_library sl(lib.path);
+    sl.add_type_alias<widget_alias>("synthetic::widget");
+
+    // The last C++ function is the worst case for the linear lookup
+    const unsigned last = lib.symbols - lib.symbols / 2 - 1;
+    const std::string last_function = "synthetic::ns_" + std::to_string(last / lib.namespace_size)
+        + "::function_" + std::to_string(last);
+
+    run("smart_library_get_function", lib, [&sl, &last_function](std::size_t) {
+        consume(reinterpret_cast<std::uintptr_t>(&sl.get_function<int(int)>(last_function)));
+    });
+
+    run("smart_library_get_mem_fn", lib, [&sl](std::size_t) {
+        consume(sl.get_mem_fn<const widget_alias, int(int)>("get") != nullptr);
+    });
+
+    const std::string last_overloaded = "synthetic::overloads::overloaded_" + std::to_string(lib.overloaded - 1);
+    run("smart_library_get_overload", lib, [&sl, &last_overloaded](std::size_t) {
+        consume(reinterpret_cast<std::uintptr_t>(&sl.get_function<int(double)>(last_overloaded)));
+    });
+
+    sl.add_type_alias<holder_alias>("synthetic::templates::holder");
+    const std::string last_template = "constant<" + std::to_string(lib.templates - 1) + ">";
+    run("smart_library_get_template_mem_fn", lib, [&sl, &last_template](std::size_t) {
+        consume(sl.get_mem_fn<const holder_alias, int(int)>(last_template) != nullptr);
+    });
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const char prefix[] = "--min-time-ms=";
+            if (!std::strncmp(argv[i], prefix, sizeof(prefix) - 1)) {
+                min_time = std::chrono::milliseconds(std::atoi(argv[i] + sizeof(prefix) - 1));
+                continue;
+            }
+
+            library_under_test lib;
+            lib.path = argv[i];
+            lib.name = lib.path.stem().string();
+            {
+                // Unloaded before the benchmarks, so that the load/unload measurement maps the library each time
+                const dll::shared_library loaded(lib.path);
+                lib.symbols = loaded.get<const unsigned>("synthetic_symbols");
+                lib.namespace_size = loaded.get<const unsigned>("synthetic_namespace_size");
+                lib.overloaded = loaded.get<const unsigned>("synthetic_overloaded");
+                lib.templates = loaded.get<const unsigned>("synthetic_templates");
+            }
+            benchmark_library(lib);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
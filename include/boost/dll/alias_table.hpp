@@ -0,0 +1,441 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/alias_table.hpp
+/// \brief Contains the BOOST_DLL_ALIAS_TABLE macro that generates a perfect hash table of aliases at compile time
+/// and the boost::dll::alias_table class that resolves aliases from such table.
+
+#ifndef BOOST_DLL_ALIAS_TABLE_HPP
+#define BOOST_DLL_ALIAS_TABLE_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/alias.hpp>
+#include <boost/dll/shared_library.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/throw_exception.hpp>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+#include <boost/dll/detail/aggressive_ptr_cast.hpp>
+#include <boost/dll/detail/name_hash.hpp>
+#include <boost/dll/detail/system_error.hpp>
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Element of the alias table generated by \forcedmacrolink{BOOST_DLL_ALIAS_TABLE}.
+*/
+struct alias_table_entry {
+    /// Hash of the `name`.
+    std::uint64_t   hash;
+
+    /// Null-terminated alias name.
+    const char*     name;
+
+    /// Address of the function or variable.
+    void*           address;
+};
+
+/// @cond
+namespace detail {
+
+// Layout of the exported table. Must be changed only together with the name of the exported symbol.
+struct alias_table_data {
+    std::size_t                             size;
+    std::size_t                             buckets;
+    const std::uint32_t*                    seeds;      // per bucket
+    const boost::dll::alias_table_entry*    entries;    // in slot order
+};
+
+constexpr std::uint64_t alias_table_mix_step(std::uint64_t x, unsigned shift, std::uint64_t multiplier) noexcept {
+    return (x ^ (x >> shift)) * multiplier;
+}
+
+constexpr std::uint64_t alias_table_mix_final(std::uint64_t x) noexcept {
+    return x ^ (x >> 31);
+}
+
+// Slot of the name with hash `hash` in the table of `size` elements for the seed of its bucket
+constexpr std::size_t alias_table_slot(std::uint64_t hash, std::uint32_t seed, std::size_t size) noexcept {
+    return static_cast<std::size_t>(
+        boost::dll::detail::alias_table_mix_final(
+            boost::dll::detail::alias_table_mix_step(
+                boost::dll::detail::alias_table_mix_step(
+                    hash + (static_cast<std::uint64_t>(seed) + 1) * 0x9E3779B97F4A7C15ULL, 30, 0xBF58476D1CE4E5B9ULL
+                ),
+                27, 0x94D049BB133111EBULL
+            )
+        ) % size
+    );
+}
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+constexpr std::uint32_t alias_table_max_seed = 1u << 16;
+
+template <std::size_t N>
+struct alias_table_layout {
+    static constexpr std::size_t buckets_count = N / 2 + 1;
+
+    std::uint32_t   seeds[buckets_count];
+    std::size_t     keys[N];    // index of the name for each slot
+    std::uint64_t   hashes[N];  // hash of the name for each slot
+    bool            ok;         // false if the names are not unique
+};
+
+// Hash and displace construction of a minimal perfect hash: names are split into buckets, then starting
+// from the biggest bucket a seed is searched that places all the names of the bucket into free slots.
+template <std::size_t N>
+constexpr boost::dll::detail::alias_table_layout<N> make_alias_table_layout(const char* const (&names)[N]) {
+    constexpr std::size_t buckets = boost::dll::detail::alias_table_layout<N>::buckets_count;
+    boost::dll::detail::alias_table_layout<N> layout{};
+
+    std::uint64_t hashes[N] = {};
+    std::size_t bucket_begin[buckets + 1] = {};
+    for (std::size_t i = 0; i < N; ++i) {
+        hashes[i] = boost::dll::detail::name_hash(names[i]);
+        ++bucket_begin[hashes[i] % buckets + 1];
+    }
+    for (std::size_t b = 0; b < buckets; ++b) {
+        bucket_begin[b + 1] += bucket_begin[b];
+    }
+
+    std::size_t members[N] = {};
+    std::size_t filled[buckets] = {};
+    for (std::size_t i = 0; i < N; ++i) {
+        const std::size_t b = hashes[i] % buckets;
+        members[bucket_begin[b] + filled[b]] = i;
+        ++filled[b];
+    }
+
+    std::size_t order[buckets] = {};
+    for (std::size_t b = 0; b < buckets; ++b) {
+        std::size_t j = b;
+        for (; j && filled[order[j - 1]] < filled[b]; --j) {
+            order[j] = order[j - 1];
+        }
+        order[j] = b;
+    }
+
+    bool used[N] = {};
+    std::size_t slots[N] = {};
+    for (std::size_t o = 0; o < buckets; ++o) {
+        const std::size_t b = order[o];
+        const std::size_t first = bucket_begin[b];
+        const std::size_t last = bucket_begin[b + 1];
+        if (first == last) {
+            break; // all the remaining buckets are empty
+        }
+
+        bool placed = false;
+        for (std::uint32_t seed = 0; seed < boost::dll::detail::alias_table_max_seed && !placed; ++seed) {
+            placed = true;
+            for (std::size_t k = first; k < last && placed; ++k) {
+                slots[k] = boost::dll::detail::alias_table_slot(hashes[members[k]], seed, N);
+                placed = !used[slots[k]];
+                for (std::size_t j = first; j < k && placed; ++j) {
+                    placed = (slots[j] != slots[k]);
+                }
+            }
+
+            if (placed) {
+                layout.seeds[b] = seed;
+                for (std::size_t k = first; k < last; ++k) {
+                    used[slots[k]] = true;
+                    layout.keys[slots[k]] = members[k];
+                    layout.hashes[slots[k]] = hashes[members[k]];
+                }
+            }
+        }
+
+        if (!placed) {
+            return layout;
+        }
+    }
+
+    layout.ok = true;
+    return layout;
+}
+
+template <std::size_t N>
+struct alias_table_storage {
+    boost::dll::alias_table_entry entries[N];
+};
+
+template <std::size_t N>
+boost::dll::detail::alias_table_storage<N> make_alias_table_storage(const boost::dll::detail::alias_table_layout<N>& layout,
+    const char* const (&names)[N], void* const (&addresses)[N]) noexcept
+{
+    boost::dll::detail::alias_table_storage<N> storage;
+    for (std::size_t slot = 0; slot < N; ++slot) {
+        storage.entries[slot].hash = layout.hashes[slot];
+        storage.entries[slot].name = names[layout.keys[slot]];
+        storage.entries[slot].address = addresses[layout.keys[slot]];
+    }
+    return storage;
+}
+
+#endif // !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+} // namespace detail
+/// @endcond
+
+/*!
+* \brief Resolves aliases of a loaded library from the table generated by \forcedmacrolink{BOOST_DLL_ALIAS_TABLE}.
+*
+* Table is located with a single symbol lookup. After that each alias is resolved by computing one hash of the name
+* and comparing the name with a single table entry. Unlike boost::dll::shared_library::get_alias() there is no
+* additional indirection: the table stores the addresses of the functions and variables.
+*
+* Table points directly to the memory of the library and is valid while the library is loaded.
+*/
+class alias_table {
+    const boost::dll::detail::alias_table_data* data_ = nullptr;
+
+    /// @cond
+    void init(const boost::dll::shared_library& lib, const char* table_name, std::error_code& ec) {
+        if (!lib.has(table_name)) {
+            ec = std::make_error_code(std::errc::invalid_argument);
+            return;
+        }
+
+        data_ = &lib.get<const boost::dll::detail::alias_table_data>(table_name);
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Creates empty table.
+    * \throws Nothing.
+    */
+    alias_table() = default;
+
+    /*!
+    * Locates the table in the loaded library.
+    *
+    * \param lib Loaded library.
+    * \param table_name Name of the table that was passed to \forcedmacrolink{BOOST_DLL_ALIAS_TABLE}.
+    * \throws \forcedlinkfs{system_error} if the library is not loaded or has no such table.
+    */
+    alias_table(const boost::dll::shared_library& lib, const char* table_name) {
+        std::error_code ec;
+        init(lib, table_name, ec);
+        if (ec) {
+            boost::dll::detail::report_error(ec, "boost::dll::alias_table::alias_table() failed: library has no such table");
+        }
+    }
+
+    /*!
+    * Locates the table in the loaded library.
+    *
+    * \param lib Loaded library.
+    * \param table_name Name of the table that was passed to \forcedmacrolink{BOOST_DLL_ALIAS_TABLE}.
+    * \param ec Variable that will be set to the result of the operation.
+    * \throws Nothing.
+    */
+    alias_table(const boost::dll::shared_library& lib, const char* table_name, std::error_code& ec) noexcept {
+        ec.clear();
+        init(lib, table_name, ec);
+    }
+
+    /*!
+    * \return Count of aliases in the table.
+    * \throws Nothing.
+    */
+    std::size_t size() const noexcept {
+        return data_ ? data_->size : 0;
+    }
+
+    /*!
+    * \return true if there are no aliases in the table.
+    * \throws Nothing.
+    */
+    bool empty() const noexcept {
+        return !size();
+    }
+
+    /*!
+    * \return Pointer to the first entry of the table. Entries are stored in the hash order.
+    * \throws Nothing.
+    */
+    const boost::dll::alias_table_entry* begin() const noexcept {
+        return data_ ? data_->entries : nullptr;
+    }
+
+    /*!
+    * \return Pointer past the last entry of the table.
+    * \throws Nothing.
+    */
+    const boost::dll::alias_table_entry* end() const noexcept {
+        return data_ ? data_->entries + data_->size : nullptr;
+    }
+
+    /*!
+    * Finds the address of the function or variable by its alias name.
+    *
+    * \param alias_name Null-terminated alias name.
+    * \return Address of the function or variable or nullptr if there is no such alias in the table.
+    * \throws Nothing.
+    */
+    void* find(const char* alias_name) const noexcept {
+        if (!data_ || !data_->size) {
+            return nullptr;
+        }
+
+        const std::uint64_t hash = boost::dll::detail::name_hash(alias_name);
+        const std::uint32_t seed = data_->seeds[hash % data_->buckets];
+        const boost::dll::alias_table_entry& entry = data_->entries[
+            boost::dll::detail::alias_table_slot(hash, seed, data_->size)
+        ];
+
+        if (entry.hash != hash || std::strcmp(entry.name, alias_name)) {
+            return nullptr;
+        }
+
+        return entry.address;
+    }
+
+    //! \overload void* find(const char* alias_name) const noexcept
+    void* find(const std::string& alias_name) const noexcept {
+        return find(alias_name.c_str());
+    }
+
+    /*!
+    * \param alias_name Null-terminated alias name.
+    * \return true if the table has an alias with such name.
+    * \throws Nothing.
+    */
+    bool has(const char* alias_name) const noexcept {
+        return !!find(alias_name);
+    }
+
+    //! \overload bool has(const char* alias_name) const noexcept
+    bool has(const std::string& alias_name) const noexcept {
+        return has(alias_name.c_str());
+    }
+
+    /*!
+    * Returns a reference to the function or variable by its alias name. Works as
+    * boost::dll::shared_library::get_alias() but without symbol lookup.
+    *
+    * \b Example:
+    * \code
+    * boost::dll::alias_table table(lib, "my_table");
+    * int& i = table.get<int>("integer_alias_name");
+    * std::size_t(&f)(const std::vector<int>&) = table.get<std::size_t(const std::vector<int>&)>("foo_bar");
+    * \endcode
+    *
+    * \tparam T Type of the function or variable. Must be explicitly specified.
+    * \param alias_name Null-terminated alias name.
+    * \throws \forcedlinkfs{system_error} if there is no such alias in the table.
+    */
+    template <typename T>
+    T& get(const char* alias_name) const {
+        void* const ret = find(alias_name);
+        if (!ret) {
+            boost::throw_exception(
+                boost::dll::fs::system_error(
+                    std::make_error_code(std::errc::invalid_argument),
+                    "boost::dll::alias_table::get() failed: no such alias"
+                )
+            );
+        }
+
+        return *boost::dll::detail::aggressive_ptr_cast<T*>(ret);
+    }
+
+    //! \overload T& get(const char* alias_name) const
+    template <typename T>
+    T& get(const std::string& alias_name) const {
+        return get<T>(alias_name.c_str());
+    }
+};
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+/// @cond
+#define BOOST_DLL_DETAIL_ALIAS_TABLE_NAME(FunctionOrVar, AliasName) #AliasName,
+#define BOOST_DLL_DETAIL_ALIAS_TABLE_ADDRESS(FunctionOrVar, AliasName) \
+    reinterpret_cast<void*>(reinterpret_cast<intptr_t>(&FunctionOrVar)),
+/// @endcond
+
+/*!
+* \brief Exports aliases for the functions and variables and a perfect hash table of those aliases, that is
+* generated at compile time. Requires C++14.
+*
+* Aliases are passed as a list macro, that applies its argument to each (function or variable, alias name) pair.
+* Each pair is exported as \forcedmacrolink{BOOST_DLL_ALIAS} does, so do not use \forcedmacrolink{BOOST_DLL_ALIAS}
+* for the same aliases. Additionally an `extern "C"` symbol `TableName` with the table is exported, that could
+* be used by the boost::dll::alias_table for resolving aliases with one hash and one comparison.
+*
+* Table describes only the aliases of a single macro invocation, so all the aliases of the table must be
+* in the same translation unit.
+*
+* \param TableName Name of the exported table. Must be a valid C identifier.
+* \param AliasList Name of the list macro.
+*
+* \b Example:
+* \code
+* #define MY_PLUGIN_ALIASES(X)          \
+*     X(foo::bar, foo_bar)              \
+*     X(foo::variable, foo_variable)    \
+*
+* BOOST_DLL_ALIAS_TABLE(my_plugin_table, MY_PLUGIN_ALIASES)
+* \endcode
+*
+* Host side:
+* \code
+* boost::dll::alias_table table(lib, "my_plugin_table");
+* std::size_t& v = table.get<std::size_t>("foo_variable");
+* \endcode
+*
+* \b Puts: aliases into `boostdll` section, `TableName` is not put into any specific section.
+*/
+#define BOOST_DLL_ALIAS_TABLE(TableName, AliasList)                                                             \
+    AliasList(BOOST_DLL_ALIAS)                                                                                  \
+    namespace _autoaliastables { namespace TableName {                                                          \
+        constexpr const char* names[] = { AliasList(BOOST_DLL_DETAIL_ALIAS_TABLE_NAME) };                       \
+        void* const addresses[] = { AliasList(BOOST_DLL_DETAIL_ALIAS_TABLE_ADDRESS) };                          \
+        constexpr auto layout = boost::dll::detail::make_alias_table_layout(names);                             \
+        static_assert(layout.ok, "Alias names in the BOOST_DLL_ALIAS_TABLE must be unique");                    \
+        const auto storage = boost::dll::detail::make_alias_table_storage(                                      \
+            layout, names, addresses                                                                            \
+        );                                                                                                      \
+    }} /* namespace _autoaliastables::TableName */                                                              \
+    namespace _autoaliases {                                                                                    \
+        extern "C" BOOST_SYMBOL_EXPORT const boost::dll::detail::alias_table_data TableName;                    \
+        const boost::dll::detail::alias_table_data TableName = {                                                \
+            sizeof(_autoaliastables::TableName::names) / sizeof(_autoaliastables::TableName::names[0]),         \
+            sizeof(_autoaliastables::TableName::layout.seeds) / sizeof(_autoaliastables::TableName::layout.seeds[0]), \
+            _autoaliastables::TableName::layout.seeds,                                                          \
+            _autoaliastables::TableName::storage.entries                                                        \
+        };                                                                                                      \
+    } /* namespace _autoaliases */                                                                              \
+    /**/
+
+#endif // BOOST_DLL_ALIAS_TABLE_HPP
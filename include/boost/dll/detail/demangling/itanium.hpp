@@ -35,6 +35,21 @@ class mangled_storage_impl : public mangled_storage_base
     {
         return get_name<Return>();
     }
+
+    template<typename Class, typename Func>
+    std::string mem_fn_matcher(const std::string &name) const;
+
+    struct is_function_named
+    {
+        std::string matcher;
+        bool operator()(const entry& e) const {return e.demangled == matcher;}
+    };
+
+    struct is_mem_fn_named
+    {
+        std::string matcher;
+        bool operator()(const entry& e) const;
+    };
 public:
     using mangled_storage_base::mangled_storage_base;
     struct ctor_sym
@@ -69,6 +84,12 @@ public:
     template<typename Class, typename Func>
     std::string get_mem_fn(const std::string &name) const;
 
+    template<typename ...Funcs>
+    std::vector<std::string> get_functions(const std::string &name) const;
+
+    template<typename ...MemFns>
+    std::vector<std::string> get_mem_fns(const std::string &name) const;
+
     template<typename Signature>
     ctor_sym get_constructor() const;
 
@@ -78,6 +99,9 @@ public:
     template<typename T>
     std::string get_type_info() const;
 
+    template<typename T>
+    std::string get_vtable() const;
+
     template<typename T>
     std::vector<std::string> get_related() const;
 
@@ -113,6 +137,10 @@ namespace parser
     std::string
     type_name(const mangled_storage_impl &);
 
+    //keys of the rendered names in the cache of the storage
+    template<typename T>    struct type_name_key;
+    template<typename Func> struct arg_list_key;
+
 
     //The purpose of this class template is to separate the pure type from the rule name from the target type
     template<typename T>
@@ -199,25 +227,55 @@ namespace parser
     template<typename T>
     std::string reference_rule() {using t_l = std::is_lvalue_reference<T>; using t_r = std::is_rvalue_reference<T>; return reference_rule_impl(t_l(), t_r());}
 
-    //it takes a string, because it may be overloaded.
     template<typename Return, typename Arg>
-    std::string arg_list(const mangled_storage_impl & ms, Return (*)(Arg))
+    void append_arg_list(const mangled_storage_impl & ms, std::string & out, Return (*)(Arg))
     {
-        using namespace std;
-        return type_name<Arg>(ms);
+        out += type_name<Arg>(ms);
     }
 
     template<typename Return, typename First, typename Second, typename ...Args>
-    std::string arg_list(const mangled_storage_impl & ms, Return (*)(First, Second, Args...))
+    void append_arg_list(const mangled_storage_impl & ms, std::string & out, Return (*)(First, Second, Args...))
     {
         using next_type = Return (*)(Second, Args...);
-        return type_name<First>(ms) + ", " + arg_list(ms, next_type());
+        out += type_name<First>(ms);
+        out += ", ";
+        append_arg_list(ms, out, next_type());
     }
 
     template<typename Return>
-    std::string arg_list(const mangled_storage_impl &, Return (*)())
+    void append_arg_list(const mangled_storage_impl &, std::string &, Return (*)())
     {
-        return "";
+    }
+
+    //it takes a string, because it may be overloaded.
+    template<typename Return, typename ...Args>
+    std::string arg_list(const mangled_storage_impl & ms, Return (*)(Args...))
+    {
+        using func_type = Return (*)(Args...);
+        return ms.cached_name<arg_list_key<Return(Args...)>>([&ms]() {
+            std::string out;
+            append_arg_list(ms, out, func_type());
+            return out;
+        });
+    }
+
+    //builds "scope::name(args)qualifiers" in a single buffer
+    inline std::string make_matcher(const std::string & scope, const std::string & name,
+                                    const std::string & args, const std::string & qualifiers = std::string())
+    {
+        std::string matcher;
+        matcher.reserve(scope.size() + name.size() + args.size() + qualifiers.size() + 4);
+        if (!scope.empty())
+        {
+            matcher += scope;
+            matcher += "::";
+        }
+        matcher += name;
+        matcher += '(';
+        matcher += args;
+        matcher += ')';
+        matcher += qualifiers;
+        return matcher;
     }
 
     //! implement
@@ -281,16 +339,16 @@ namespace parser
     {
         using namespace parser;
         using type = dummy<T>*;
-        return  parse_type(ms, type());
+        return ms.cached_name<type_name_key<T>>([&ms]() { return parse_type(ms, type()); });
     }
 }
 
 template<typename T> std::string mangled_storage_impl::get_variable(const std::string &name) const
 {
-    auto found = std::find_if(storage_.begin(), storage_.end(),
+    auto found = std::find_if(storage_->begin(), storage_->end(),
             [&](const entry& e) {return e.demangled == name;});
 
-    if (found != storage_.end())
+    if (found != storage_->end())
         return found->mangled;
     else
         return "";
@@ -300,10 +358,10 @@ template<typename Func> std::string mangled_storage_impl::get_function(const std
 {
     using func_type = Func*;
 
-    auto matcher = name + '(' + parser::arg_list(*this, func_type()) + ')';
+    auto matcher = parser::make_matcher(std::string(), name, parser::arg_list(*this, func_type()));
 
-    auto found = std::find_if(storage_.begin(), storage_.end(), [&](const entry& e) {return e.demangled == matcher;});
-    if (found != storage_.end())
+    auto found = std::find_if(storage_->begin(), storage_->end(), [&](const entry& e) {return e.demangled == matcher;});
+    if (found != storage_->end())
         return found->mangled;
     else
         return "";
@@ -311,46 +369,68 @@ template<typename Func> std::string mangled_storage_impl::get_function(const std
 }
 
 template<typename Class, typename Func>
-std::string mangled_storage_impl::get_mem_fn(const std::string &name) const
+std::string mangled_storage_impl::mem_fn_matcher(const std::string &name) const
 {
     using namespace parser;
 
     using func_type = Func*;
 
-    std::string cname = get_name<Class>();
-
-    const auto matcher = cname + "::" + name +
-             '(' + parser::arg_list(*this, func_type()) + ')'
-             + const_rule<Class>() + volatile_rule<Class>();
+    return make_matcher(get_name<Class>(), name, parser::arg_list(*this, func_type()),
+             const_rule<Class>() + volatile_rule<Class>());
+}
 
+inline bool mangled_storage_impl::is_mem_fn_named::operator()(const entry& e) const
+{
     // Linux export table contains int MyClass::Func<float>(), but expected in import_mangled MyClass::Func<float>() without returned type.
-    auto found = std::find_if(storage_.begin(), storage_.end(), [&matcher](const entry& e) {
-        if (e.demangled == matcher) {
-          return true;
-        }
+    if (e.demangled == matcher) {
+      return true;
+    }
 
-        const auto pos = e.demangled.rfind(matcher);
-        if (pos == std::string::npos) {
-          // Not found.
-          return false;
-        }
+    const auto pos = e.demangled.rfind(matcher);
+    if (pos == std::string::npos) {
+      // Not found.
+      return false;
+    }
 
-        if (pos + matcher.size() != e.demangled.size()) {
-          // There are some characters after the `matcher` string.
-          return false;
-        }
+    if (pos + matcher.size() != e.demangled.size()) {
+      // There are some characters after the `matcher` string.
+      return false;
+    }
+
+    // Double checking that we matched a full function name
+    return e.demangled[pos - 1] == ' '; // `if (e.demangled == matcher)` makes sure that `pos > 0`
+}
 
-        // Double checking that we matched a full function name
-        return e.demangled[pos - 1] == ' '; // `if (e.demangled == matcher)` makes sure that `pos > 0`
-    });
+template<typename Class, typename Func>
+std::string mangled_storage_impl::get_mem_fn(const std::string &name) const
+{
+    auto found = std::find_if(storage_->begin(), storage_->end(), is_mem_fn_named{mem_fn_matcher<Class, Func>(name)});
 
-    if (found != storage_.end())
+    if (found != storage_->end())
         return found->mangled;
     else
         return "";
 
 }
 
+template<typename ...Funcs>
+std::vector<std::string> mangled_storage_impl::get_functions(const std::string &name) const
+{
+    const is_function_named predicates[] = {
+        is_function_named{parser::make_matcher(std::string(), name, parser::arg_list(*this, static_cast<Funcs*>(nullptr)))}...
+    };
+    return find_each(predicates);
+}
+
+template<typename ...MemFns>
+std::vector<std::string> mangled_storage_impl::get_mem_fns(const std::string &name) const
+{
+    const is_mem_fn_named predicates[] = {
+        is_mem_fn_named{mem_fn_matcher<typename MemFns::class_type, typename MemFns::func_type>(name)}...
+    };
+    return find_each(predicates);
+}
+
 
 template<typename Signature>
 auto mangled_storage_impl::get_constructor() const -> ctor_sym
@@ -376,12 +456,11 @@ auto mangled_storage_impl::get_constructor() const -> ctor_sym
         }
     }
 
-    auto matcher =
-                ctor_name + '(' + parser::arg_list(*this, func_type()) + ')';
+    auto matcher = make_matcher(std::string(), ctor_name, parser::arg_list(*this, func_type()));
 
 
     std::vector<entry> findings;
-    std::copy_if(storage_.begin(), storage_.end(),
+    std::copy_if(storage_->begin(), storage_->end(),
             std::back_inserter(findings), [&](const entry& e) {return e.demangled == matcher;});
 
     ctor_sym ct;
@@ -425,7 +504,7 @@ auto mangled_storage_impl::get_destructor() const -> dtor_sym
 
     dtor_sym dt;
     //this is so simple, i don#t need a predicate
-    for (auto & s : storage_)
+    for (auto & s : *storage_)
     {
         //alright, name fits
         if (s.demangled == dtor_name)
@@ -454,10 +533,30 @@ std::string mangled_storage_impl::get_type_info() const
                     return e.demangled == id;
                 };
 
-    auto found = std::find_if(storage_.begin(), storage_.end(), predicate);
+    auto found = std::find_if(storage_->begin(), storage_->end(), predicate);
+
+
+    if (found != storage_->end())
+        return found->mangled;
+    else
+        return "";
+}
+
+template<typename T>
+std::string mangled_storage_impl::get_vtable() const
+{
+    std::string id = "vtable for " + get_name<T>();
+
+
+    auto predicate = [&](const mangled_storage_base::entry & e)
+                {
+                    return e.demangled == id;
+                };
+
+    auto found = std::find_if(storage_->begin(), storage_->end(), predicate);
 
 
-    if (found != storage_.end())
+    if (found != storage_->end())
         return found->mangled;
     else
         return "";
@@ -469,7 +568,7 @@ std::vector<std::string> mangled_storage_impl::get_related()  const
     std::vector<std::string> ret;
     auto name = get_name<T>();
 
-    for (auto & c : storage_)
+    for (auto & c : *storage_)
     {
         if (c.demangled.find(name) != std::string::npos)
             ret.push_back(c.demangled);
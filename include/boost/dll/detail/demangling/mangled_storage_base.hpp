@@ -11,14 +11,17 @@
 #include <boost/type_index/ctti_type_index.hpp>
 
 #if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
 #include <vector>
 #include <string>
 #include <map>
 #include <type_traits>
+#include <utility>
 #endif // !defined(BOOST_DLL_USE_STD_MODULE)
 #endif // !defined(BOOST_DLL_INTERFACE_UNIT)
 
 #include <boost/dll/detail/demangling/demangle_symbol.hpp>
+#include <boost/dll/detail/type_keyed_cache.hpp>
 #include <boost/dll/library_info.hpp>
 
 namespace boost { namespace dll { namespace detail {
@@ -38,37 +41,99 @@ struct mangled_storage_base
         entry &operator= (entry&&)         = default;
     };
 protected:
-    std::vector<entry> storage_;
+    ///symbols, shared between the copies until the symbols of a copy change
+    boost::dll::detail::shared_ptr<std::vector<entry>> storage_
+        = boost::dll::detail::make_shared<std::vector<entry>>();
     ///if a unknown class is imported it can be overloaded by this type
     std::map<boost::typeindex::ctti_type_index, std::string> aliases_;
+    ///rendered type names and symbols resolved by the owners, shared between the copies until the symbols or aliases change
+    boost::dll::detail::shared_ptr<boost::dll::detail::type_keyed_cache> cache_
+        = boost::dll::detail::make_shared<boost::dll::detail::type_keyed_cache>();
+
+    template<typename T> struct name_key;
+
+    ///returns the symbols for a change, copying them if they are shared with other copies
+    std::vector<entry> & change_storage()
+    {
+        cache_ = boost::dll::detail::make_shared<boost::dll::detail::type_keyed_cache>();
+        if (storage_.use_count() != 1)
+            storage_ = boost::dll::detail::make_shared<std::vector<entry>>(*storage_);
+        return *storage_;
+    }
 public:
     void assign(const mangled_storage_base & storage)
     {
         aliases_  = storage.aliases_;
         storage_  = storage.storage_;
+        cache_    = storage.cache_;
     }
     void swap( mangled_storage_base & storage)
     {
         aliases_.swap(storage.aliases_);
         storage_.swap(storage.storage_);
+        cache_.swap(storage.cache_);
     }
     void clear()
     {
-        storage_.clear();
+        storage_ = boost::dll::detail::make_shared<std::vector<entry>>();
         aliases_.clear();
+        cache_ = boost::dll::detail::make_shared<boost::dll::detail::type_keyed_cache>();
+    }
+
+    ///returns the value resolved by `resolve` for the Key, resolving it only on the first request
+    template<typename Key, typename Value, typename Resolver>
+    const Value & cached(Resolver resolve) const
+    {
+        return cache_->get<Key, Value>(resolve);
+    }
+    ///returns the name rendered by `render` for the Key, rendering it only on the first request
+    template<typename Key, typename Render>
+    std::string cached_name(Render render) const
+    {
+        return cached<Key, std::string>(render);
+    }
+    ///count of the cached names and resolved symbols
+    std::size_t cache_size() const {return cache_->size();}
+
+    const std::vector<entry> & get_storage() const {return *storage_;};
+    ///drops the cached values, as the returned symbols may be changed
+    std::vector<entry> & get_storage() {return change_storage();};
+
+    ///returns the mangled names of the first entries that satisfy each of the predicates, using a single pass over the storage
+    template<typename Predicate, std::size_t N>
+    std::vector<std::string> find_each(const Predicate (&predicates)[N]) const
+    {
+        std::vector<std::string> found(N);
+        std::size_t remaining = N;
+        for (auto & e : *storage_)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (found[i].empty() && predicates[i](e))
+                {
+                    found[i] = e.mangled;
+                    if (!--remaining)
+                        return found;
+                }
+            }
+        }
+        return found;
     }
-    std::vector<entry> & get_storage() {return storage_;};
     template<typename T>
     std::string get_name() const
     {
-        using boost::typeindex::ctti_type_index;
-        auto tx = ctti_type_index::type_id<T>();
-        auto val = (aliases_.count(tx) > 0) ? aliases_.at(tx) : tx.pretty_name();
-        return val;
+        return cached_name<name_key<T>>([this]() {
+            using boost::typeindex::ctti_type_index;
+            auto tx = ctti_type_index::type_id<T>();
+            const auto it = aliases_.find(tx);
+            return (it != aliases_.end()) ? it->second : tx.pretty_name();
+        });
     }
 
     mangled_storage_base() = default;
-    mangled_storage_base(mangled_storage_base&&) = default;
+    ///moved from storage keeps sharing the symbols, so that it stays usable
+    mangled_storage_base(mangled_storage_base&& storage) noexcept
+        : storage_(storage.storage_), aliases_(std::move(storage.aliases_)), cache_(storage.cache_) {}
     mangled_storage_base(const mangled_storage_base&) = default;
 
     mangled_storage_base(const std::vector<std::string> & symbols) { add_symbols(symbols);}
@@ -83,11 +148,11 @@ public:
 
     }
 
-    void load(library_info & li) { storage_.clear(); add_symbols(li.symbols()); };
+    void load(library_info & li) { storage_ = boost::dll::detail::make_shared<std::vector<entry>>(); add_symbols(li.symbols()); };
     void load(const boost::dll::fs::path& library_path,
             bool throw_if_not_native_format = true)
     {
-        storage_.clear();
+        storage_ = boost::dll::detail::make_shared<std::vector<entry>>();
         add_symbols(library_info(library_path, throw_if_not_native_format).symbols());
     };
 
@@ -104,16 +169,18 @@ public:
             boost::typeindex::ctti_type_index::type_id<Alias>(),
             name
             );
+        cache_ = boost::dll::detail::make_shared<boost::dll::detail::type_keyed_cache>();
     }
     void add_symbols(const std::vector<std::string> & symbols)
     {
+        std::vector<entry> & storage = change_storage();
         for (auto & sym : symbols)
         {
             auto dm = demangle_symbol(sym);
             if (!dm.empty())
-                storage_.emplace_back(sym, dm);
+                storage.emplace_back(sym, dm);
             else
-                storage_.emplace_back(sym, sym);
+                storage.emplace_back(sym, sym);
         }
     }
 
@@ -13,6 +13,7 @@
 #if !defined(BOOST_DLL_USE_STD_MODULE)
 #include <iterator>
 #include <algorithm>
+#include <functional>
 #include <type_traits>
 #endif // !defined(BOOST_DLL_USE_STD_MODULE)
 #endif // !defined(BOOST_DLL_INTERFACE_UNIT)
@@ -49,6 +50,12 @@ public:
     template<typename Class, typename Func>
     std::string get_mem_fn(const std::string &name) const;
 
+    template<typename ...Funcs>
+    std::vector<std::string> get_functions(const std::string &name) const;
+
+    template<typename ...MemFns>
+    std::vector<std::string> get_mem_fns(const std::string &name) const;
+
     template<typename Signature>
     ctor_sym get_constructor() const;
 
@@ -337,9 +344,9 @@ namespace parser {
 
 template<typename T>
 std::string mangled_storage_impl::get_variable(const std::string &name) const {
-    const auto found = std::find_if(storage_.begin(), storage_.end(), parser::is_variable_with_name<T>(name, *this));
+    const auto found = std::find_if(storage_->begin(), storage_->end(), parser::is_variable_with_name<T>(name, *this));
 
-    if (found != storage_.end())
+    if (found != storage_->end())
         return found->mangled;
     else
         return "";
@@ -347,9 +354,9 @@ std::string mangled_storage_impl::get_variable(const std::string &name) const {
 
 template<typename Func>
 std::string mangled_storage_impl::get_function(const std::string &name) const {
-    const auto found = std::find_if(storage_.begin(), storage_.end(), parser::is_function_with_name<Func*>(name, *this));
+    const auto found = std::find_if(storage_->begin(), storage_->end(), parser::is_function_with_name<Func*>(name, *this));
 
-    if (found != storage_.end())
+    if (found != storage_->end())
         return found->mangled;
     else
         return "";
@@ -357,14 +364,30 @@ std::string mangled_storage_impl::get_function(const std::string &name) const {
 
 template<typename Class, typename Func>
 std::string mangled_storage_impl::get_mem_fn(const std::string &name) const {
-    const auto found = std::find_if(storage_.begin(), storage_.end(), parser::is_mem_fn_with_name<Class, Func*>(name, *this));
+    const auto found = std::find_if(storage_->begin(), storage_->end(), parser::is_mem_fn_with_name<Class, Func*>(name, *this));
 
-    if (found != storage_.end())
+    if (found != storage_->end())
         return found->mangled;
     else
         return "";
 }
 
+template<typename ...Funcs>
+std::vector<std::string> mangled_storage_impl::get_functions(const std::string &name) const {
+    const std::function<bool(const entry&)> predicates[] = {
+        parser::is_function_with_name<Funcs*>(name, *this)...
+    };
+    return find_each(predicates);
+}
+
+template<typename ...MemFns>
+std::vector<std::string> mangled_storage_impl::get_mem_fns(const std::string &name) const {
+    const std::function<bool(const entry&)> predicates[] = {
+        parser::is_mem_fn_with_name<typename MemFns::class_type, typename MemFns::func_type*>(name, *this)...
+    };
+    return find_each(predicates);
+}
+
 
 template<typename Signature>
 auto mangled_storage_impl::get_constructor() const -> ctor_sym {
@@ -385,9 +408,9 @@ auto mangled_storage_impl::get_constructor() const -> ctor_sym {
         }
     }
 
-    const auto f = std::find_if(storage_.begin(), storage_.end(), parser::is_constructor_with_name<Signature*>(ctor_name, *this));
+    const auto f = std::find_if(storage_->begin(), storage_->end(), parser::is_constructor_with_name<Signature*>(ctor_name, *this));
 
-    if (f != storage_.end())
+    if (f != storage_->end())
         return f->mangled;
     else
         return "";
@@ -412,9 +435,9 @@ auto mangled_storage_impl::get_destructor() const -> dtor_sym {
         }
     }
 
-    const auto found = std::find_if(storage_.begin(), storage_.end(), parser::is_destructor_with_name(dtor_name));
+    const auto found = std::find_if(storage_->begin(), storage_->end(), parser::is_destructor_with_name(dtor_name));
 
-    if (found != storage_.end())
+    if (found != storage_->end())
         return found->mangled;
     else
         return "";
@@ -429,10 +452,10 @@ std::string mangled_storage_impl::get_vtable() const {
                     return e.demangled == id;
                 };
 
-    auto found = std::find_if(storage_.begin(), storage_.end(), predicate);
+    auto found = std::find_if(storage_->begin(), storage_->end(), predicate);
 
 
-    if (found != storage_.end())
+    if (found != storage_->end())
         return found->mangled;
     else
         return "";
@@ -443,7 +466,7 @@ std::vector<std::string> mangled_storage_impl::get_related() const {
     std::vector<std::string> ret;
     auto name = get_name<T>();
 
-    for (auto & c : storage_)
+    for (auto & c : *storage_)
     {
         if (c.demangled.find(name) != std::string::npos)
             ret.push_back(c.demangled);
@@ -18,13 +18,18 @@
 #include <boost/throw_exception.hpp>
 
 #if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
+#include <string>
+#include <utility>
 #include <vector>
 #endif // !defined(BOOST_DLL_USE_STD_MODULE)
 #endif // !defined(BOOST_DLL_INTERFACE_UNIT)
 
+#include <boost/dll/symbol_info.hpp>
+
 namespace boost { namespace dll { namespace detail {
 
 template <class AddressOffsetT>
@@ -96,6 +101,38 @@ struct Elf_Sym_template<std::uint64_t> {
 using Elf32_Sym_ = Elf_Sym_template<std::uint32_t>;
 using Elf64_Sym_ = Elf_Sym_template<std::uint64_t>;
 
+// Symbol versioning structures are the same for 32 and 64 bit ELF
+struct Elf_Verdef_ {
+  std::uint16_t   vd_version;     /* Version revision */
+  std::uint16_t   vd_flags;       /* Version information */
+  std::uint16_t   vd_ndx;         /* Version Index */
+  std::uint16_t   vd_cnt;         /* Number of associated aux entries */
+  std::uint32_t   vd_hash;        /* Version name hash value */
+  std::uint32_t   vd_aux;         /* Offset in bytes to verdaux array */
+  std::uint32_t   vd_next;        /* Offset in bytes to next verdef entry */
+};
+
+struct Elf_Verdaux_ {
+  std::uint32_t   vda_name;       /* Version or dependency names */
+  std::uint32_t   vda_next;       /* Offset in bytes to next verdaux entry */
+};
+
+struct Elf_Verneed_ {
+  std::uint16_t   vn_version;     /* Version of structure */
+  std::uint16_t   vn_cnt;         /* Number of associated aux entries */
+  std::uint32_t   vn_file;        /* Offset of filename for this dependency */
+  std::uint32_t   vn_aux;         /* Offset in bytes to vernaux array */
+  std::uint32_t   vn_next;        /* Offset in bytes to next verneed entry */
+};
+
+struct Elf_Vernaux_ {
+  std::uint32_t   vna_hash;       /* Hash value of dependency name */
+  std::uint16_t   vna_flags;      /* Dependency specific information */
+  std::uint16_t   vna_other;      /* Version Index */
+  std::uint32_t   vna_name;       /* Dependency name string offset */
+  std::uint32_t   vna_next;       /* Offset in bytes to next vernaux entry */
+};
+
 template <class AddressOffsetT>
 class elf_info {
     using header_t = boost::dll::detail::Elf_Ehdr_template<AddressOffsetT>;
@@ -104,11 +141,27 @@ class elf_info {
 
     static constexpr std::uint32_t SHT_SYMTAB_ = 2;
     static constexpr std::uint32_t SHT_STRTAB_ = 3;
+    static constexpr std::uint32_t SHT_NOTE_ = 7;
+    static constexpr std::uint32_t SHT_NOBITS_ = 8;
     static constexpr std::uint32_t SHT_DYNSYM_ = 11;
+    static constexpr std::uint32_t SHT_GNU_verdef_ = 0x6ffffffd;
+    static constexpr std::uint32_t SHT_GNU_verneed_ = 0x6ffffffe;
+    static constexpr std::uint32_t SHT_GNU_versym_ = 0x6fffffff;
+
+    static constexpr std::uint16_t VERSYM_HIDDEN_ = 0x8000;
+    static constexpr std::uint16_t VERSYM_VERSION_ = 0x7fff;
+    static constexpr std::uint16_t VER_FLG_BASE_ = 0x1;     /* Version definition of the file itself */
 
     static constexpr unsigned char STB_LOCAL_ = 0;   /* Local symbol */
     static constexpr unsigned char STB_GLOBAL_ = 1;  /* Global symbol */
     static constexpr unsigned char STB_WEAK_ = 2;    /* Weak symbol */
+    static constexpr unsigned char STB_GNU_UNIQUE_ = 10; /* Unique symbol */
+
+    static constexpr unsigned char STT_OBJECT_ = 1;      /* Symbol is a data object */
+    static constexpr unsigned char STT_FUNC_ = 2;        /* Symbol is a code object */
+    static constexpr unsigned char STT_COMMON_ = 5;      /* Symbol is a common data object */
+    static constexpr unsigned char STT_TLS_ = 6;         /* Symbol is thread-local data object*/
+    static constexpr unsigned char STT_GNU_IFUNC_ = 10;  /* Symbol is indirect code object */
 
     /* Symbol visibility specification encoded in the st_other field.  */
     static constexpr unsigned char STV_DEFAULT_ = 0;      /* Default symbol visibility rules */
@@ -134,8 +187,8 @@ public:
         return true;
     }
 
-    static std::vector<std::string> sections(std::ifstream& fs) {
-        std::vector<std::string> ret;
+    static void sections(std::ifstream& fs, std::vector<std::string>& ret) {
+        ret.clear();
         std::vector<char> names;
         sections_names_raw(fs, names);
 
@@ -150,7 +203,11 @@ public:
                 ++name_begin;
             }
         } while (name_begin != name_end);
+    }
 
+    static std::vector<std::string> sections(std::ifstream& fs) {
+        std::vector<std::string> ret;
+        sections(fs, ret);
         return ret;
     }
 
@@ -201,7 +258,8 @@ private:
         symbols_text(fs, symbols, text, names);
     }
 
-    static void symbols_text(std::ifstream& fs, std::vector<symbol_t>& symbols, std::vector<char>& text, const std::vector<char>& names) {
+    // Returns `true` if symbols were taken from the ".dynsym" section
+    static bool symbols_text(std::ifstream& fs, std::vector<symbol_t>& symbols, std::vector<char>& text, const std::vector<char>& names) {
         const header_t elf = header(fs);
         checked_seekg(fs, elf.e_shoff);
 
@@ -242,16 +300,18 @@ private:
             }
         }
 
+        bool from_dynsym = false;
         if (!symtab_size || !strtab_size) {
             // ".symtab" stripped from the binary and we have to fallback to ".dynsym"
             symtab_size = dynsym_size;
             symtab_offset = dynsym_offset;
             strtab_size = dynstr_size;
             strtab_offset = dynstr_offset;
+            from_dynsym = true;
         }
 
         if (!symtab_size || !strtab_size) {
-            return;
+            return from_dynsym;
         }
 
         text.resize(static_cast<std::size_t>(strtab_size) + 1, '\0');
@@ -261,6 +321,174 @@ private:
         symbols.resize(static_cast<std::size_t>(symtab_size / sizeof(symbol_t)));
         checked_seekg(fs, symtab_offset);
         read_raw(fs, symbols[0], static_cast<std::size_t>(symtab_size - (symtab_size % sizeof(symbol_t))) );
+
+        return from_dynsym;
+    }
+
+    static std::vector<section_t> section_headers(std::ifstream& fs) {
+        const header_t elf = header(fs);
+
+        std::vector<section_t> ret(elf.e_shnum);
+        if (!ret.empty()) {
+            checked_seekg(fs, elf.e_shoff);
+            read_raw(fs, ret[0], ret.size() * sizeof(section_t));
+        }
+
+        return ret;
+    }
+
+    template <class T>
+    static void section_content(std::ifstream& fs, const section_t& section, std::vector<T>& out) {
+        out.resize(static_cast<std::size_t>(section.sh_size / sizeof(T)) + 1);
+        checked_seekg(fs, section.sh_offset);
+        read_raw(fs, out[0], static_cast<std::size_t>(section.sh_size - section.sh_size % sizeof(T)));
+    }
+
+    template <class T>
+    static const T* entry_at(const std::vector<char>& data, std::size_t offset) noexcept {
+        if (offset > data.size() || data.size() - offset < sizeof(T)) {
+            return nullptr;
+        }
+
+        return reinterpret_cast<const T*>(&data[offset]);
+    }
+
+    // Versions of the ".dynsym" symbols.
+    struct versions_t {
+        std::vector<symbol_t>       symbols;    // content of the ".dynsym"
+        std::vector<char>           text;       // content of the ".dynstr"
+        std::vector<std::uint16_t>  versym;     // content of the ".gnu.version", index of a version for each symbol
+        std::vector<std::string>    names;      // version names by version index
+    };
+
+    static void symbols_versions(std::ifstream& fs, versions_t& versions) {
+        const std::vector<section_t> headers = section_headers(fs);
+
+        const section_t* versym = nullptr;
+        for (std::size_t i = 0; i < headers.size(); ++i) {
+            if (headers[i].sh_type == SHT_GNU_versym_) {
+                versym = &headers[i];
+                break;
+            }
+        }
+
+        if (!versym || versym->sh_link >= headers.size()) {
+            return; // No versioning info
+        }
+
+        const section_t& dynsym = headers[versym->sh_link];
+        if (dynsym.sh_link >= headers.size()) {
+            return;
+        }
+
+        section_content(fs, dynsym, versions.symbols);
+        versions.symbols.pop_back();
+        section_content(fs, headers[dynsym.sh_link], versions.text);
+        section_content(fs, *versym, versions.versym);
+        versions.versym.pop_back();
+
+        std::vector<char> data;
+        for (std::size_t i = 0; i < headers.size(); ++i) {
+            if (headers[i].sh_type != SHT_GNU_verdef_ && headers[i].sh_type != SHT_GNU_verneed_) {
+                continue;
+            }
+            if (headers[i].sh_link != dynsym.sh_link) {
+                continue; // Names are not in the ".dynstr"
+            }
+
+            section_content(fs, headers[i], data);
+            std::size_t offset = 0;
+            for (std::size_t j = 0; j < headers[i].sh_info; ++j) {
+                if (headers[i].sh_type == SHT_GNU_verdef_) {
+                    const Elf_Verdef_* def = entry_at<Elf_Verdef_>(data, offset);
+                    if (!def) {
+                        break;
+                    }
+
+                    // The first auxiliary entry holds the name of the version, others are parents
+                    const Elf_Verdaux_* aux = entry_at<Elf_Verdaux_>(data, offset + def->vd_aux);
+                    if (aux && def->vd_cnt && !(def->vd_flags & VER_FLG_BASE_)) {
+                        add_version_name(versions, def->vd_ndx & VERSYM_VERSION_, aux->vda_name);
+                    }
+
+                    if (!def->vd_next) {
+                        break;
+                    }
+                    offset += def->vd_next;
+                } else {
+                    const Elf_Verneed_* need = entry_at<Elf_Verneed_>(data, offset);
+                    if (!need) {
+                        break;
+                    }
+
+                    std::size_t aux_offset = offset + need->vn_aux;
+                    for (std::size_t k = 0; k < need->vn_cnt; ++k) {
+                        const Elf_Vernaux_* aux = entry_at<Elf_Vernaux_>(data, aux_offset);
+                        if (!aux) {
+                            break;
+                        }
+
+                        add_version_name(versions, aux->vna_other & VERSYM_VERSION_, aux->vna_name);
+                        if (!aux->vna_next) {
+                            break;
+                        }
+                        aux_offset += aux->vna_next;
+                    }
+
+                    if (!need->vn_next) {
+                        break;
+                    }
+                    offset += need->vn_next;
+                }
+            }
+        }
+    }
+
+    static void add_version_name(versions_t& versions, std::size_t index, std::uint32_t name) {
+        if (name >= versions.text.size()) {
+            return;
+        }
+
+        if (versions.names.size() <= index) {
+            versions.names.resize(index + 1);
+        }
+        versions.names[index] = &versions.text[name];
+    }
+
+    static void fill_version(const versions_t& versions, std::size_t dynsym_index, boost::dll::symbol_info& info) {
+        if (dynsym_index >= versions.versym.size()) {
+            return;
+        }
+
+        const std::uint16_t versym = versions.versym[dynsym_index];
+        // 0 is for local symbols and 1 is for unversioned global symbols
+        const std::size_t index = versym & VERSYM_VERSION_;
+        if (index > 1 && index < versions.names.size()) {
+            info.version = versions.names[index];
+        }
+        info.default_version = !(versym & VERSYM_HIDDEN_);
+    }
+
+    static boost::dll::symbol_type symbol_type(const symbol_t& sym) noexcept {
+        switch (sym.st_info & 0x0f) {
+        case STT_OBJECT_:       return boost::dll::symbol_type::object;
+        case STT_FUNC_:         return boost::dll::symbol_type::function;
+        case STT_COMMON_:       return boost::dll::symbol_type::common;
+        case STT_TLS_:          return boost::dll::symbol_type::tls;
+        case STT_GNU_IFUNC_:    return boost::dll::symbol_type::indirect_function;
+        }
+
+        return boost::dll::symbol_type::unknown;
+    }
+
+    static boost::dll::symbol_binding symbol_binding(const symbol_t& sym) noexcept {
+        switch (sym.st_info >> 4) {
+        case STB_LOCAL_:        return boost::dll::symbol_binding::local;
+        case STB_WEAK_:         return boost::dll::symbol_binding::weak;
+        case STB_GNU_UNIQUE_:   return boost::dll::symbol_binding::unique;
+        }
+
+        return boost::dll::symbol_binding::global;
     }
 
     static bool is_visible(const symbol_t& sym) noexcept {
@@ -272,8 +500,13 @@ private:
     }
 
 public:
-    static std::vector<std::string> symbols(std::ifstream& fs) {
-        std::vector<std::string> ret;
+    static void sections_table(std::ifstream& fs, std::vector<section_t>& sections, std::vector<char>& names) {
+        sections = section_headers(fs);
+        sections_names_raw(fs, names);
+    }
+
+    static void symbols(std::ifstream& fs, std::vector<std::string>& ret) {
+        ret.clear();
 
         std::vector<symbol_t> symbols;
         std::vector<char>   text;
@@ -288,6 +521,174 @@ public:
                 }
             }
         }
+    }
+
+    static std::vector<std::string> symbols(std::ifstream& fs) {
+        std::vector<std::string> ret;
+        symbols(fs, ret);
+        return ret;
+    }
+
+    static bool has_symbol(std::ifstream& fs, const char* symbol_name) {
+        std::vector<symbol_t> symbols;
+        std::vector<char>   text;
+        symbols_text(fs, symbols, text);
+
+        for (std::size_t i = 0; i < symbols.size(); ++i) {
+            if (is_visible(symbols[i]) && symbols[i].st_name < text.size() && !std::strcmp(&text[symbols[i].st_name], symbol_name)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static bool section_location(std::ifstream& fs, const char* section_name, std::uint64_t& offset, std::uint64_t& size) {
+        std::vector<char> names;
+        sections_names_raw(fs, names);
+
+        const std::vector<section_t> headers = section_headers(fs);
+        for (std::size_t i = 0; i < headers.size(); ++i) {
+            if (headers[i].sh_name >= names.size() || std::strcmp(&names[headers[i].sh_name], section_name)) {
+                continue;
+            }
+
+            offset = headers[i].sh_offset;
+            // Sections like ".bss" occupy no space in the file
+            size = (headers[i].sh_type == SHT_NOBITS_ ? 0 : headers[i].sh_size);
+            return true;
+        }
+
+        return false;
+    }
+
+    // Offsets and sizes of the ".dynsym" and ".dynstr" sections. Symbols are not parsed.
+    static void symbol_table_location(std::ifstream& fs, std::vector<std::pair<std::uint64_t, std::uint64_t> >& ranges) {
+        ranges.clear();
+
+        std::vector<char> names;
+        sections_names_raw(fs, names);
+
+        const std::vector<section_t> headers = section_headers(fs);
+        for (std::size_t i = 0; i < headers.size(); ++i) {
+            if (headers[i].sh_type == SHT_NOBITS_ || headers[i].sh_name >= names.size()) {
+                continue;
+            }
+
+            const char* name = &names[headers[i].sh_name];
+            if (!std::strcmp(name, ".dynsym") || !std::strcmp(name, ".dynstr")) {
+                ranges.emplace_back(headers[i].sh_offset, headers[i].sh_size);
+            }
+        }
+    }
+
+    static bool build_id(std::ifstream& fs, std::vector<unsigned char>& id) {
+        static constexpr std::uint32_t NT_GNU_BUILD_ID_ = 3;
+
+        struct note_header_t {
+            std::uint32_t   n_namesz;
+            std::uint32_t   n_descsz;
+            std::uint32_t   n_type;
+        };
+
+        const std::vector<section_t> headers = section_headers(fs);
+        std::vector<char> notes;
+        for (std::size_t i = 0; i < headers.size(); ++i) {
+            if (headers[i].sh_type != SHT_NOTE_) {
+                continue;
+            }
+
+            section_content(fs, headers[i], notes);
+            notes.pop_back();
+
+            std::size_t offset = 0;
+            while (const note_header_t* note = entry_at<note_header_t>(notes, offset)) {
+                // Name and descriptor are padded to 4 bytes
+                const std::size_t name_offset = offset + sizeof(note_header_t);
+                const std::size_t desc_offset = name_offset + ((static_cast<std::size_t>(note->n_namesz) + 3) & ~static_cast<std::size_t>(3));
+                const std::size_t next_offset = desc_offset + ((static_cast<std::size_t>(note->n_descsz) + 3) & ~static_cast<std::size_t>(3));
+                if (desc_offset > notes.size() || notes.size() - desc_offset < note->n_descsz) {
+                    break;
+                }
+
+                if (note->n_type == NT_GNU_BUILD_ID_ && note->n_namesz == 4 && !std::memcmp(&notes[name_offset], "GNU", 4)) {
+                    const unsigned char* desc = reinterpret_cast<const unsigned char*>(&notes[desc_offset]);
+                    id.assign(desc, desc + note->n_descsz);
+                    return !id.empty();
+                }
+
+                offset = next_offset;
+            }
+        }
+
+        return false;
+    }
+
+    static std::vector<boost::dll::symbol_info> symbols_info(std::ifstream& fs) {
+        std::vector<boost::dll::symbol_info> ret;
+
+        std::vector<symbol_t> symbols;
+        std::vector<char>   text;
+        std::vector<char> names;
+        sections_names_raw(fs, names);
+        const bool from_dynsym = symbols_text(fs, symbols, text, names);
+
+        versions_t versions;
+        symbols_versions(fs, versions);
+
+        // ".symtab" has a different order of symbols, so the ".dynsym" symbols are matched by name and value
+        std::vector<std::pair<std::pair<std::string, AddressOffsetT>, std::size_t> > dynsym_index;
+        if (!from_dynsym && !versions.versym.empty()) {
+            dynsym_index.reserve(versions.symbols.size());
+            for (std::size_t i = 0; i < versions.symbols.size(); ++i) {
+                if (versions.symbols[i].st_name < versions.text.size() && versions.symbols[i].st_shndx) {
+                    dynsym_index.push_back(std::make_pair(
+                        std::make_pair(std::string(&versions.text[versions.symbols[i].st_name]), versions.symbols[i].st_value),
+                        i
+                    ));
+                }
+            }
+            std::sort(dynsym_index.begin(), dynsym_index.end());
+        }
+
+        ret.reserve(symbols.size());
+        for (std::size_t i = 0; i < symbols.size(); ++i) {
+            if (!is_visible(symbols[i]) || symbols[i].st_name >= text.size() || !text[symbols[i].st_name]) {
+                continue;
+            }
+
+            ret.push_back(boost::dll::symbol_info());
+            boost::dll::symbol_info& info = ret.back();
+            info.name = &text[symbols[i].st_name];
+            info.address = symbols[i].st_value;
+            info.size = symbols[i].st_size;
+            info.type = symbol_type(symbols[i]);
+            info.binding = symbol_binding(symbols[i]);
+            info.section_index = symbols[i].st_shndx;
+
+            if (from_dynsym) {
+                fill_version(versions, i, info);
+                continue;
+            }
+
+            // Symbols with explicit versions have the version in the ".symtab" name: "name@version" or "name@@version"
+            const std::string::size_type at = info.name.find('@');
+            if (at != std::string::npos) {
+                const bool is_default = (info.name.size() > at + 1 && info.name[at + 1] == '@');
+                info.version = info.name.substr(at + (is_default ? 2 : 1));
+                info.default_version = is_default;
+                info.name.resize(at);
+                continue;
+            }
+
+            const std::pair<std::string, AddressOffsetT> key(info.name, symbols[i].st_value);
+            const auto it = std::lower_bound(
+                dynsym_index.begin(), dynsym_index.end(), std::make_pair(key, std::size_t(0))
+            );
+            if (it != dynsym_index.end() && it->first == key) {
+                fill_version(versions, it->second, info);
+            }
+        }
 
         return ret;
     }
@@ -0,0 +1,169 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_FILE_CHANGE_NOTIFIER_HPP
+#define BOOST_DLL_DETAIL_FILE_CHANGE_NOTIFIER_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/predef/os.h>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+
+#if BOOST_OS_LINUX
+#   include <fcntl.h>
+#   include <poll.h>
+#   include <sys/inotify.h>
+#   include <unistd.h>
+#endif
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+namespace boost { namespace dll { namespace detail {
+
+#if BOOST_OS_LINUX
+
+// Waits for changes in the watched directories using inotify. A pipe is used to interrupt the wait.
+class file_change_notifier {
+    int inotify_ = -1;
+    int pipe_[2] = {-1, -1};
+
+    // Watch descriptor of the directory to count of its users. Adding a watch for the already watched
+    // directory returns the same descriptor.
+    std::map<int, std::size_t> watches_;
+
+    void drain(int fd) noexcept {
+        char buffer[4096];
+        while (::read(fd, buffer, sizeof(buffer)) > 0) {}
+    }
+
+public:
+    file_change_notifier() noexcept {
+        inotify_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (::pipe(pipe_) == 0) {
+            ::fcntl(pipe_[0], F_SETFL, O_NONBLOCK);
+            ::fcntl(pipe_[0], F_SETFD, FD_CLOEXEC);
+            ::fcntl(pipe_[1], F_SETFD, FD_CLOEXEC);
+        } else {
+            pipe_[0] = pipe_[1] = -1;
+        }
+    }
+
+    file_change_notifier(const file_change_notifier&) = delete;
+    file_change_notifier& operator=(const file_change_notifier&) = delete;
+
+    ~file_change_notifier() {
+        if (inotify_ >= 0) {
+            ::close(inotify_);
+        }
+        if (pipe_[0] >= 0) {
+            ::close(pipe_[0]);
+            ::close(pipe_[1]);
+        }
+    }
+
+    // Files are often replaced by rename, so the whole directory is watched. Returns the watch descriptor
+    // that must be passed to remove_directory(), or -1 if the directory is not watched.
+    int add_directory(const boost::dll::fs::path& directory) {
+        if (inotify_ < 0) {
+            return -1;
+        }
+
+        const int wd = ::inotify_add_watch(inotify_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ATTRIB);
+        if (wd >= 0) {
+            ++watches_[wd];
+        }
+        return wd;
+    }
+
+    // Stops watching the directory when its last user is removed
+    void remove_directory(int wd) noexcept {
+        const std::map<int, std::size_t>::iterator it = watches_.find(wd);
+        if (it == watches_.end() || --it->second) {
+            return;
+        }
+
+        watches_.erase(it);
+        ::inotify_rm_watch(inotify_, wd);
+    }
+
+    // Returns after a change, after `timeout` or after interrupt(), whichever comes first
+    void wait(std::chrono::milliseconds timeout) noexcept {
+        struct pollfd fds[2];
+        fds[0].fd = inotify_;
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+        fds[1].fd = pipe_[0];
+        fds[1].events = POLLIN;
+        fds[1].revents = 0;
+
+        if (::poll(fds, 2, static_cast<int>(timeout.count())) <= 0) {
+            return;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            drain(inotify_);
+        }
+        if (fds[1].revents & POLLIN) {
+            drain(pipe_[0]);
+        }
+    }
+
+    void interrupt() noexcept {
+        if (pipe_[1] >= 0) {
+            const char c = 0;
+            const ssize_t written = ::write(pipe_[1], &c, 1);
+            (void)written;
+        }
+    }
+};
+
+#else
+
+// No change notifications on this platform, changes are detected by periodic polling
+class file_change_notifier {
+    std::mutex                  mutex_;
+    std::condition_variable     cv_;
+    bool                        interrupted_ = false;
+
+public:
+    file_change_notifier() = default;
+    file_change_notifier(const file_change_notifier&) = delete;
+    file_change_notifier& operator=(const file_change_notifier&) = delete;
+
+    int add_directory(const boost::dll::fs::path& /*directory*/) noexcept { return -1; }
+    void remove_directory(int /*wd*/) noexcept {}
+
+    void wait(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait_for(lock, timeout, [this]() { return interrupted_; });
+        interrupted_ = false;
+    }
+
+    void interrupt() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            interrupted_ = true;
+        }
+        cv_.notify_all();
+    }
+};
+
+#endif
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_FILE_CHANGE_NOTIFIER_HPP
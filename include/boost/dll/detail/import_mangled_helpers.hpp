@@ -14,6 +14,7 @@
 
 #if !defined(BOOST_DLL_INTERFACE_UNIT)
 #if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
 #include <type_traits>
 #endif // !defined(BOOST_DLL_USE_STD_MODULE)
 #endif // !defined(BOOST_DLL_INTERFACE_UNIT)
@@ -24,6 +25,18 @@ namespace boost { namespace dll { namespace experimental { namespace detail {
 template<class ...Args>
 struct sequence {};
 
+template<std::size_t ...I>
+struct index_sequence {};
+
+template<std::size_t N, std::size_t ...I>
+struct make_index_sequence : make_index_sequence<N - 1, N - 1, I...> {};
+
+template<std::size_t ...I>
+struct make_index_sequence<0, I...>
+{
+    typedef index_sequence<I...> type;
+};
+
 template<class Value, class Seq> struct push_front;
 template<class Value, class ...Args>
 struct push_front<Value, sequence<Args...>>
@@ -18,12 +18,16 @@
 #if !defined(BOOST_DLL_USE_STD_MODULE)
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <string> // for std::getline
+#include <utility>
 #include <vector>
 #endif // !defined(BOOST_DLL_USE_STD_MODULE)
 #endif // !defined(BOOST_DLL_INTERFACE_UNIT)
 
+#include <boost/dll/symbol_info.hpp>
+
 namespace boost { namespace dll { namespace detail {
 
 using integer_t = int;
@@ -148,6 +152,12 @@ struct symtab_command_ {
     std::uint32_t    strsize;    /* string table size in bytes */
 };
 
+struct uuid_command_ {
+    std::uint32_t    cmd;        /* LC_UUID_ */
+    std::uint32_t    cmdsize;    /* sizeof(struct uuid_command) */
+    std::uint8_t     uuid[16];   /* the 128-bit uuid */
+};
+
 template <class AddressOffsetT>
 struct nlist_template {
     std::uint32_t     n_strx;
@@ -270,11 +280,170 @@ private:
         }
     };
 
+    struct symbol_name_finder {
+        const char*                     symbol_name;
+        bool&                           found;
+
+        void operator()(std::ifstream& fs) const {
+            symbol_header_t symbh;
+            read_raw(fs, symbh);
+
+            nlist_t symbol;
+            std::string name;
+            for (std::size_t j = 0; j < symbh.nsyms && !found; ++j) {
+                fs.seekg(symbh.symoff + j * sizeof(nlist_t));
+                read_raw(fs, symbol);
+                if (!symbol.n_strx || (symbol.n_type & 0x0e) != 0xe || !symbol.n_sect) {
+                    continue; // Symbol has no name or no section
+                }
+
+                fs.seekg(symbh.stroff + symbol.n_strx);
+                std::getline(fs, name, '\0');
+
+                // Linker adds additional '_' symbol, see symbol_names_gather.
+                found = (!name.empty() && name[0] == '_' ? !std::strcmp(name.c_str() + 1, symbol_name) : name == symbol_name);
+            }
+        }
+    };
+
+    struct section_flags_gather {
+        std::vector<std::uint32_t>&     ret;
+
+        void operator()(std::ifstream& fs) const {
+            segment_t segment;
+            read_raw(fs, segment);
+
+            section_t section;
+            ret.reserve(ret.size() + segment.nsects);
+            for (std::size_t j = 0; j < segment.nsects; ++j) {
+                read_raw(fs, section);
+                ret.push_back(section.flags);
+            }
+        }
+    };
+
+    struct section_location_gather {
+        const char*         section_name;
+        bool&               found;
+        std::uint64_t&      offset;
+        std::uint64_t&      size;
+
+        static constexpr std::uint32_t SECTION_TYPE_ = 0x000000ff;      /* 256 section types */
+        static constexpr std::uint32_t S_ZEROFILL_ = 0x1;               /* zero fill on demand section */
+        static constexpr std::uint32_t S_GB_ZEROFILL_ = 0xc;            /* zero fill on demand section (that can be larger than 4 gigabytes) */
+        static constexpr std::uint32_t S_THREAD_LOCAL_ZEROFILL_ = 0x12; /* thread local zerofill section */
+
+        void operator()(std::ifstream& fs) const {
+            segment_t segment;
+            read_raw(fs, segment);
+
+            section_t section;
+            for (std::size_t j = 0; j < segment.nsects && !found; ++j) {
+                read_raw(fs, section);
+                // `segname` goes right after the `sectname`.
+                // Forcing `sectname` to end on '\0'
+                section.segname[0] = '\0';
+                if (std::strcmp(section.sectname, section_name)) {
+                    continue;
+                }
+
+                const std::uint32_t type = (section.flags & SECTION_TYPE_);
+                found = true;
+                offset = section.offset;
+                size = (type == S_ZEROFILL_ || type == S_GB_ZEROFILL_ || type == S_THREAD_LOCAL_ZEROFILL_ ? 0 : section.size);
+            }
+        }
+    };
+
+    struct uuid_gather {
+        std::vector<unsigned char>&     id;
+
+        void operator()(std::ifstream& fs) const {
+            boost::dll::detail::uuid_command_ cmd;
+            read_raw(fs, cmd);
+            id.assign(cmd.uuid, cmd.uuid + sizeof(cmd.uuid));
+        }
+    };
+
+    struct symbol_table_location_gather {
+        std::vector<std::pair<std::uint64_t, std::uint64_t> >&  ranges;
+
+        void operator()(std::ifstream& fs) const {
+            symbol_header_t symbh;
+            read_raw(fs, symbh);
+            ranges.emplace_back(symbh.symoff, static_cast<std::uint64_t>(symbh.nsyms) * sizeof(nlist_t));
+            ranges.emplace_back(symbh.stroff, symbh.strsize);
+        }
+    };
+
+    struct symbol_info_gather {
+        std::vector<boost::dll::symbol_info>&   ret;
+        const std::vector<std::uint32_t>&       section_flags;
+
+        static constexpr std::uint8_t N_EXT_ = 0x01;                            /* external symbol bit */
+        static constexpr std::uint8_t N_PEXT_ = 0x10;                           /* private external symbol bit */
+        static constexpr std::uint16_t N_WEAK_DEF_ = 0x0080;                    /* coalesced symbol is a weak definition */
+        static constexpr std::uint32_t S_ATTR_PURE_INSTRUCTIONS_ = 0x80000000;  /* section contains only true machine instructions */
+        static constexpr std::uint32_t S_ATTR_SOME_INSTRUCTIONS_ = 0x00000400;  /* section contains some machine instructions */
+
+        void operator()(std::ifstream& fs) const {
+            symbol_header_t symbh;
+            read_raw(fs, symbh);
+            ret.reserve(ret.size() + symbh.nsyms);
+
+            nlist_t symbol;
+            std::string symbol_name;
+            for (std::size_t j = 0; j < symbh.nsyms; ++j) {
+                fs.seekg(symbh.symoff + j * sizeof(nlist_t));
+                read_raw(fs, symbol);
+                if (!symbol.n_strx) {
+                    continue; // Symbol has no name
+                }
+
+                if ((symbol.n_type & 0x0e) != 0xe || !symbol.n_sect) {
+                    continue; // Symbol has no section
+                }
+
+                fs.seekg(symbh.stroff + symbol.n_strx);
+                std::getline(fs, symbol_name, '\0');
+                if (symbol_name.empty()) {
+                    continue;
+                }
+
+                ret.push_back(boost::dll::symbol_info());
+                boost::dll::symbol_info& info = ret.back();
+
+                // Linker adds additional '_' symbol. Could not find official docs for that case.
+                info.name = (symbol_name[0] == '_' ? symbol_name.substr(1) : symbol_name);
+                info.address = symbol.n_value;
+                info.section_index = symbol.n_sect;
+
+                if (!(symbol.n_type & N_EXT_) || (symbol.n_type & N_PEXT_)) {
+                    info.binding = boost::dll::symbol_binding::local;
+                } else if (symbol.n_desc & N_WEAK_DEF_) {
+                    info.binding = boost::dll::symbol_binding::weak;
+                }
+
+                info.type = boost::dll::symbol_type::object;
+                if (symbol.n_sect <= section_flags.size()
+                    && (section_flags[symbol.n_sect - 1] & (S_ATTR_PURE_INSTRUCTIONS_ | S_ATTR_SOME_INSTRUCTIONS_)))
+                {
+                    info.type = boost::dll::symbol_type::function;
+                }
+            }
+        }
+    };
+
 public:
-    static std::vector<std::string> sections(std::ifstream& fs) {
-        std::vector<std::string> ret;
+    static void sections(std::ifstream& fs, std::vector<std::string>& ret) {
+        ret.clear();
         section_names_gather f = { ret };
         command_finder(fs, SEGMENT_CMD_NUMBER, f);
+    }
+
+    static std::vector<std::string> sections(std::ifstream& fs) {
+        std::vector<std::string> ret;
+        sections(fs, ret);
         return ret;
     }
 
@@ -289,9 +458,53 @@ private:
     }
 
 public:
+    static void symbols(std::ifstream& fs, std::vector<std::string>& ret) {
+        ret.clear();
+        symbol_names_gather f = { ret, 0 };
+        command_finder(fs, load_command_types::LC_SYMTAB_, f);
+    }
+
     static std::vector<std::string> symbols(std::ifstream& fs) {
         std::vector<std::string> ret;
-        symbol_names_gather f = { ret, 0 };
+        symbols(fs, ret);
+        return ret;
+    }
+
+    static bool has_symbol(std::ifstream& fs, const char* symbol_name) {
+        bool found = false;
+        symbol_name_finder f = { symbol_name, found };
+        command_finder(fs, load_command_types::LC_SYMTAB_, f);
+        return found;
+    }
+
+    static bool section_location(std::ifstream& fs, const char* section_name, std::uint64_t& offset, std::uint64_t& size) {
+        bool found = false;
+        section_location_gather f = { section_name, found, offset, size };
+        command_finder(fs, SEGMENT_CMD_NUMBER, f);
+        return found;
+    }
+
+    static bool build_id(std::ifstream& fs, std::vector<unsigned char>& id) {
+        id.clear();
+        uuid_gather f = { id };
+        command_finder(fs, load_command_types::LC_UUID_, f);
+        return !id.empty();
+    }
+
+    // Offsets and sizes of the symbol and string tables from LC_SYMTAB. Symbols are not parsed.
+    static void symbol_table_location(std::ifstream& fs, std::vector<std::pair<std::uint64_t, std::uint64_t> >& ranges) {
+        ranges.clear();
+        symbol_table_location_gather f = { ranges };
+        command_finder(fs, load_command_types::LC_SYMTAB_, f);
+    }
+
+    static std::vector<boost::dll::symbol_info> symbols_info(std::ifstream& fs) {
+        std::vector<std::uint32_t> flags;
+        section_flags_gather sections_f = { flags };
+        command_finder(fs, SEGMENT_CMD_NUMBER, sections_f);
+
+        std::vector<boost::dll::symbol_info> ret;
+        symbol_info_gather f = { ret, flags };
         command_finder(fs, load_command_types::LC_SYMTAB_, f);
         return ret;
     }
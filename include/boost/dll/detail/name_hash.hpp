@@ -0,0 +1,34 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_NAME_HASH_HPP
+#define BOOST_DLL_DETAIL_NAME_HASH_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstdint>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+namespace boost { namespace dll { namespace detail {
+
+// 64 bit FNV-1a hash of a null-terminated name. Used for the names that are hashed at compile time in
+// one binary and at runtime in another, so the function must never change.
+constexpr std::uint64_t name_hash(const char* name, std::uint64_t hash = 14695981039346656037ULL) noexcept {
+    return *name
+        ? boost::dll::detail::name_hash(name + 1, (hash ^ static_cast<unsigned char>(*name)) * 1099511628211ULL)
+        : hash;
+}
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_NAME_HASH_HPP
@@ -20,10 +20,13 @@
 #include <cstring>
 #include <fstream>
 #include <string> // for std::getline
+#include <utility>
 #include <vector>
 #endif // !defined(BOOST_DLL_USE_STD_MODULE)
 #endif // !defined(BOOST_DLL_INTERFACE_UNIT)
 
+#include <boost/dll/symbol_info.hpp>
+
 namespace boost { namespace dll { namespace detail {
 
 // reference:
@@ -93,6 +96,17 @@ struct IMAGE_EXPORT_DIRECTORY_ { // 32/64 independent header
     boost::dll::detail::DWORD_  AddressOfNameOrdinals;
 };
 
+struct IMAGE_DEBUG_DIRECTORY_ { // 32/64 independent header
+    boost::dll::detail::DWORD_  Characteristics;
+    boost::dll::detail::DWORD_  TimeDateStamp;
+    boost::dll::detail::WORD_   MajorVersion;
+    boost::dll::detail::WORD_   MinorVersion;
+    boost::dll::detail::DWORD_  Type;
+    boost::dll::detail::DWORD_  SizeOfData;
+    boost::dll::detail::DWORD_  AddressOfRawData;
+    boost::dll::detail::DWORD_  PointerToRawData;
+};
+
 struct IMAGE_SECTION_HEADER_ { // 32/64 independent header
     static const std::size_t    IMAGE_SIZEOF_SHORT_NAME_ = 8;
 
@@ -253,8 +267,8 @@ private:
     }
 
 public:
-    static std::vector<std::string> sections(std::ifstream& fs) {
-        std::vector<std::string> ret;
+    static void sections(std::ifstream& fs, std::vector<std::string>& ret) {
+        ret.clear();
 
         const header_t h = header(fs);
         ret.reserve(h.FileHeader.NumberOfSections);
@@ -277,19 +291,23 @@ public:
                 ret.push_back(name_helper);
             }
         }
+    }
 
+    static std::vector<std::string> sections(std::ifstream& fs) {
+        std::vector<std::string> ret;
+        sections(fs, ret);
         return ret;
     }
 
-    static std::vector<std::string> symbols(std::ifstream& fs) {
-        std::vector<std::string> ret;
+    static void symbols(std::ifstream& fs, std::vector<std::string>& ret) {
+        ret.clear();
 
         const header_t h = header(fs);
         const exports_t exprt = exports(fs, h);
         const std::size_t exported_symbols = exprt.NumberOfNames;
 
         if (exported_symbols == 0) {
-            return ret;
+            return;
         }
 
         const std::size_t fixed_names_addr = get_file_offset(fs, exprt.AddressOfNames, h);
@@ -304,6 +322,195 @@ public:
             std::getline(fs, symbol_name, '\0');
             ret.push_back(symbol_name);
         }
+    }
+
+    static std::vector<std::string> symbols(std::ifstream& fs) {
+        std::vector<std::string> ret;
+        symbols(fs, ret);
+        return ret;
+    }
+
+    static bool has_symbol(std::ifstream& fs, const char* symbol_name) {
+        const header_t h = header(fs);
+        const exports_t exprt = exports(fs, h);
+        const std::size_t exported_symbols = exprt.NumberOfNames;
+
+        if (exported_symbols == 0) {
+            return false;
+        }
+
+        const std::size_t fixed_names_addr = get_file_offset(fs, exprt.AddressOfNames, h);
+
+        boost::dll::detail::DWORD_ name_offset;
+        std::string name;
+        for (std::size_t i = 0;i < exported_symbols;++i) {
+            fs.seekg(fixed_names_addr + i * sizeof(name_offset));
+            read_raw(fs, name_offset);
+            fs.seekg(get_file_offset(fs, name_offset, h));
+            std::getline(fs, name, '\0');
+            if (name == symbol_name) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static bool section_location(std::ifstream& fs, const char* section_name, std::uint64_t& offset, std::uint64_t& size) {
+        const header_t h = header(fs);
+
+        section_t image_section_header;
+        char name_helper[section_t::IMAGE_SIZEOF_SHORT_NAME_ + 1];
+        std::memset(name_helper, 0, sizeof(name_helper));
+        for (std::size_t i = 0;i < h.FileHeader.NumberOfSections;++i) {
+            // There is no terminating null character if the string is exactly eight characters long
+            read_raw(fs, image_section_header);
+            std::memcpy(name_helper, image_section_header.Name, section_t::IMAGE_SIZEOF_SHORT_NAME_);
+            if (std::strcmp(section_name, name_helper)) {
+                continue;
+            }
+
+            offset = image_section_header.PointerToRawData;
+            // Raw data is padded up to the file alignment, virtual size is the real size of the data
+            size = image_section_header.SizeOfRawData;
+            if (image_section_header.Misc.VirtualSize && image_section_header.Misc.VirtualSize < size) {
+                size = image_section_header.Misc.VirtualSize;
+            }
+            if (!offset) {
+                size = 0; // Uninitialized data
+            }
+            return true;
+        }
+
+        return false;
+    }
+
+    // Offset and size of the export directory with the names of exported symbols. Symbols are not parsed.
+    static void symbol_table_location(std::ifstream& fs, std::vector<std::pair<std::uint64_t, std::uint64_t> >& ranges) {
+        static const unsigned int IMAGE_DIRECTORY_ENTRY_EXPORT_ = 0;
+        ranges.clear();
+
+        const header_t h = header(fs);
+        const IMAGE_DATA_DIRECTORY_ dir = h.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT_];
+        if (dir.VirtualAddress == 0 || dir.Size == 0) {
+            return; // No exported symbols
+        }
+
+        const std::size_t offset = get_file_offset(fs, dir.VirtualAddress, h);
+        if (offset) {
+            ranges.emplace_back(offset, dir.Size);
+        }
+    }
+
+    static bool build_id(std::ifstream& fs, std::vector<unsigned char>& id) {
+        static const unsigned int IMAGE_DIRECTORY_ENTRY_DEBUG_ = 6;
+        static const boost::dll::detail::DWORD_ IMAGE_DEBUG_TYPE_CODEVIEW_ = 2;
+        static const boost::dll::detail::DWORD_ CV_SIGNATURE_RSDS_ = 0x53445352; // 'RSDS'
+        static const std::size_t GUID_AND_AGE_SIZE_ = 16 + 4;
+
+        const header_t h = header(fs);
+        if (h.OptionalHeader.NumberOfRvaAndSizes <= IMAGE_DIRECTORY_ENTRY_DEBUG_) {
+            return false;
+        }
+
+        const IMAGE_DATA_DIRECTORY_ dir = h.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_DEBUG_];
+        if (dir.VirtualAddress == 0) {
+            return false;
+        }
+
+        const std::size_t dir_offset = get_file_offset(fs, dir.VirtualAddress, h);
+        if (!dir_offset) {
+            return false;
+        }
+
+        IMAGE_DEBUG_DIRECTORY_ debug;
+        for (std::size_t i = 0; i < dir.Size / sizeof(debug); ++i) {
+            fs.seekg(dir_offset + i * sizeof(debug));
+            read_raw(fs, debug);
+            if (debug.Type != IMAGE_DEBUG_TYPE_CODEVIEW_ || debug.SizeOfData < sizeof(boost::dll::detail::DWORD_) + GUID_AND_AGE_SIZE_) {
+                continue;
+            }
+
+            boost::dll::detail::DWORD_ signature;
+            fs.seekg(debug.PointerToRawData);
+            read_raw(fs, signature);
+            if (signature != CV_SIGNATURE_RSDS_) {
+                continue;
+            }
+
+            id.resize(GUID_AND_AGE_SIZE_);
+            read_raw(fs, id[0], GUID_AND_AGE_SIZE_);
+            return true;
+        }
+
+        return false;
+    }
+
+    static std::vector<boost::dll::symbol_info> symbols_info(std::ifstream& fs) {
+        static const boost::dll::detail::DWORD_ IMAGE_SCN_CNT_CODE_ = 0x00000020;
+        static const boost::dll::detail::DWORD_ IMAGE_SCN_MEM_EXECUTE_ = 0x20000000;
+
+        std::vector<boost::dll::symbol_info> ret;
+
+        const header_t h = header(fs);
+        const exports_t exprt = exports(fs, h);
+        const std::size_t exported_symbols = exprt.NumberOfNames;
+
+        if (exported_symbols == 0) {
+            return ret;
+        }
+
+        std::vector<section_t> section_headers(h.FileHeader.NumberOfSections);
+        {   // fs.seekg to the beginning on section headers
+            dos_t dos;
+            fs.seekg(0);
+            read_raw(fs, dos);
+            fs.seekg(dos.e_lfanew + sizeof(header_t));
+        }
+        for (std::size_t i = 0; i < section_headers.size(); ++i) {
+            read_raw(fs, section_headers[i]);
+        }
+
+        const std::size_t fixed_names_addr = get_file_offset(fs, exprt.AddressOfNames, h);
+        const std::size_t fixed_ordinals_addr = get_file_offset(fs, exprt.AddressOfNameOrdinals, h);
+        const std::size_t fixed_functions_addr = get_file_offset(fs, exprt.AddressOfFunctions, h);
+
+        ret.reserve(exported_symbols);
+        boost::dll::detail::DWORD_ name_offset;
+        boost::dll::detail::DWORD_ rva;
+        boost::dll::detail::WORD_ ordinal;
+        for (std::size_t i = 0;i < exported_symbols;++i) {
+            fs.seekg(fixed_ordinals_addr + i * sizeof(ordinal));
+            read_raw(fs, ordinal);
+            if (ordinal >= exprt.NumberOfFunctions) {  // required for clang-win created PE
+                continue;
+            }
+
+            fs.seekg(fixed_functions_addr + ordinal * sizeof(rva));
+            read_raw(fs, rva);
+
+            ret.push_back(boost::dll::symbol_info());
+            boost::dll::symbol_info& info = ret.back();
+
+            fs.seekg(fixed_names_addr + i * sizeof(name_offset));
+            read_raw(fs, name_offset);
+            fs.seekg(get_file_offset(fs, name_offset, h));
+            std::getline(fs, info.name, '\0');
+
+            info.address = rva;
+            info.type = boost::dll::symbol_type::object;
+            for (std::size_t j = 0; j < section_headers.size(); ++j) {
+                const section_t& section = section_headers[j];
+                const std::size_t section_size = (section.Misc.VirtualSize ? section.Misc.VirtualSize : section.SizeOfRawData);
+                if (rva >= section.VirtualAddress && rva < section.VirtualAddress + section_size) {
+                    info.section_index = j + 1;
+                    if (section.Characteristics & (IMAGE_SCN_CNT_CODE_ | IMAGE_SCN_MEM_EXECUTE_)) {
+                        info.type = boost::dll::symbol_type::function;
+                    }
+                    break;
+                }
+            }
+        }
 
         return ret;
     }
@@ -0,0 +1,522 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_POSIX_LOADED_IMAGE_IMPL_HPP
+#define BOOST_DLL_DETAIL_POSIX_LOADED_IMAGE_IMPL_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/predef/os.h>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+
+#include <dlfcn.h>
+#if BOOST_OS_MACOS || BOOST_OS_IOS
+#   include <mach-o/dyld.h>
+#elif !BOOST_OS_ANDROID && !BOOST_OS_QNX && !BOOST_OS_CYGWIN
+#   include <link.h>
+#endif
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+#include <boost/dll/detail/posix/program_location_impl.hpp>
+
+#if BOOST_OS_MACOS || BOOST_OS_IOS
+#   include <boost/dll/detail/macho_info.hpp>
+#elif !BOOST_OS_ANDROID && !BOOST_OS_QNX && !BOOST_OS_CYGWIN
+#   include <boost/dll/detail/elf_info.hpp>
+#else
+#   include <boost/dll/detail/posix/path_from_handle.hpp>
+#   include <boost/dll/library_info.hpp>
+#endif
+
+namespace boost { namespace dll { namespace detail {
+
+#if BOOST_OS_MACOS || BOOST_OS_IOS
+
+// Mach-O keeps the load commands and the `__LINKEDIT` segment with the symbol table in memory
+class loaded_image_impl {
+    using address_t = std::conditional<sizeof(void*) == 8, std::uint64_t, std::uint32_t>::type;
+    using header_t = boost::dll::detail::mach_header_template<address_t>;
+    using segment_t = boost::dll::detail::segment_command_template<address_t>;
+    using section_t = boost::dll::detail::section_template<address_t>;
+    using nlist_t = boost::dll::detail::nlist_template<address_t>;
+    using load_command_t = boost::dll::detail::load_command_;
+    using symtab_t = boost::dll::detail::symtab_command_;
+
+    static constexpr std::uint32_t SEGMENT_CMD_NUMBER = (
+        sizeof(address_t) > 4 ? load_command_types::LC_SEGMENT_64_ : load_command_types::LC_SEGMENT_
+    );
+
+    const header_t*     header_ = nullptr;
+    std::intptr_t       slide_ = 0;
+
+    template <class F>
+    void for_each_command(F f) const {
+        const char* command = reinterpret_cast<const char*>(header_) + sizeof(header_t);
+        for (std::size_t i = 0; i < header_->ncmds; ++i) {
+            const load_command_t& lc = *reinterpret_cast<const load_command_t*>(command);
+            f(lc);
+            command += lc.cmdsize;
+        }
+    }
+
+    // Sections in the order of their indexes, that start from 1
+    std::vector<const section_t*> section_headers() const {
+        std::vector<const section_t*> ret;
+        for_each_command([&ret](const load_command_t& lc) {
+            if (lc.cmd != SEGMENT_CMD_NUMBER) {
+                return;
+            }
+
+            const segment_t& segment = reinterpret_cast<const segment_t&>(lc);
+            const section_t* sections = reinterpret_cast<const section_t*>(&segment + 1);
+            for (std::size_t j = 0; j < segment.nsects; ++j) {
+                ret.push_back(sections + j);
+            }
+        });
+        return ret;
+    }
+
+    static std::string section_name(const section_t& section) {
+        // There is no terminating null character if the name is exactly 16 characters long
+        return std::string(section.sectname, ::strnlen(section.sectname, sizeof(section.sectname)));
+    }
+
+    std::vector<std::string> collect_symbols(std::size_t section_index) const {
+        std::vector<std::string> ret;
+
+        const symtab_t* symtab = nullptr;
+        const segment_t* linkedit = nullptr;
+        for_each_command([&symtab, &linkedit](const load_command_t& lc) {
+            if (lc.cmd == load_command_types::LC_SYMTAB_) {
+                symtab = reinterpret_cast<const symtab_t*>(&lc);
+            } else if (lc.cmd == SEGMENT_CMD_NUMBER
+                && !std::strncmp(reinterpret_cast<const segment_t&>(lc).segname, "__LINKEDIT", 16))
+            {
+                linkedit = reinterpret_cast<const segment_t*>(&lc);
+            }
+        });
+
+        if (!symtab || !linkedit) {
+            return ret;
+        }
+
+        // Symbol table offsets are file offsets inside of the `__LINKEDIT` segment
+        const char* linkedit_base = reinterpret_cast<const char*>(slide_ + linkedit->vmaddr - linkedit->fileoff);
+        const nlist_t* symbols = reinterpret_cast<const nlist_t*>(linkedit_base + symtab->symoff);
+        const char* strings = linkedit_base + symtab->stroff;
+
+        ret.reserve(symtab->nsyms);
+        for (std::size_t i = 0; i < symtab->nsyms; ++i) {
+            const nlist_t& symbol = symbols[i];
+            if (!symbol.n_strx || symbol.n_strx >= symtab->strsize) {
+                continue; // Symbol has no name
+            }
+
+            if ((symbol.n_type & 0x0e) != 0xe || !symbol.n_sect) {
+                continue; // Symbol has no section
+            }
+
+            if (section_index && section_index != symbol.n_sect) {
+                continue; // Not in the required section
+            }
+
+            const char* name = strings + symbol.n_strx;
+            if (*name == '_') {
+                // Linker adds additional '_' symbol. Could not find official docs for that case.
+                ++name;
+            }
+
+            if (*name) {
+                ret.push_back(name);
+            }
+        }
+
+        return ret;
+    }
+
+public:
+    void init(void* handle, std::error_code& ec) {
+        const std::uint32_t count = _dyld_image_count();
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const char* const name = _dyld_get_image_name(i);
+            if (!name) {
+                continue;
+            }
+
+            // Does not increase the reference count of already loaded image
+            void* const image_handle = dlopen(name, RTLD_LAZY | RTLD_NOLOAD);
+            if (!image_handle) {
+                continue;
+            }
+            dlclose(image_handle);
+
+            if (image_handle == handle) {
+                header_ = reinterpret_cast<const header_t*>(_dyld_get_image_header(i));
+                slide_ = _dyld_get_image_vmaddr_slide(i);
+                return;
+            }
+        }
+
+        ec = std::make_error_code(std::errc::bad_file_descriptor);
+    }
+
+    std::vector<std::string> sections() const {
+        std::vector<std::string> ret;
+        const std::vector<const section_t*> headers = section_headers();
+        ret.reserve(headers.size());
+        for (std::size_t i = 0; i < headers.size(); ++i) {
+            ret.push_back(section_name(*headers[i]));
+            if (ret.back().empty()) {
+                ret.pop_back(); // Do not show empty names
+            }
+        }
+        return ret;
+    }
+
+    bool section(const char* name, const char*& data, std::size_t& size) const {
+        const std::vector<const section_t*> headers = section_headers();
+        for (std::size_t i = 0; i < headers.size(); ++i) {
+            if (section_name(*headers[i]) == name) {
+                data = reinterpret_cast<const char*>(slide_ + headers[i]->addr);
+                size = static_cast<std::size_t>(headers[i]->size);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Checks that the address is inside of the image and not inside of one of its dependencies
+    bool contains(const void* address) const noexcept {
+        Dl_info info;
+        // Some of the libc headers miss `const` in `dladdr(const void*, Dl_info*)`
+        return dladdr(const_cast<void*>(address), &info) && info.dli_fbase == header_;
+    }
+
+    std::vector<std::string> symbols() const {
+        return collect_symbols(0);
+    }
+
+    std::vector<std::string> symbols(const char* section_name_to_find) const {
+        const std::vector<const section_t*> headers = section_headers();
+        for (std::size_t i = 0; i < headers.size(); ++i) {
+            if (section_name(*headers[i]) == section_name_to_find) {
+                return collect_symbols(i + 1);
+            }
+        }
+
+        return std::vector<std::string>();
+    }
+};
+
+#elif !BOOST_OS_ANDROID && !BOOST_OS_QNX && !BOOST_OS_CYGWIN
+
+// Dynamic symbol table of ELF is located via the dynamic section, that is always in memory. Section
+// headers are not loaded into memory, so section names are read from the section header table of the file.
+class loaded_image_impl {
+    using address_t = std::conditional<sizeof(void*) == 8, std::uint64_t, std::uint32_t>::type;
+    using section_t = boost::dll::detail::Elf_Shdr_template<address_t>;
+    using symbol_t = boost::dll::detail::Elf_Sym_template<address_t>;
+
+    static constexpr std::uint64_t SHF_ALLOC_ = 0x2;        /* Occupies memory during execution */
+    static constexpr std::uint16_t SHN_UNDEF_ = 0;          /* Undefined section */
+
+    // Section header table of the file, read on the first request. Shared between the copies.
+    struct sections_table_t {
+        std::mutex              mutex;
+        bool                    read = false;
+        std::vector<section_t>  sections;
+        std::vector<char>       names;
+    };
+
+    std::uintptr_t          base_ = 0;
+    const symbol_t*         symbols_ = nullptr;
+    std::size_t             symbols_count_ = 0;
+    const char*             strings_ = nullptr;
+    std::size_t             strings_size_ = 0;
+    boost::dll::fs::path    path_;
+    const void*             file_base_ = nullptr;   // `dli_fbase` of the image
+    boost::dll::detail::shared_ptr<sections_table_t> sections_table_
+        = boost::dll::detail::make_shared<sections_table_t>();
+
+    const void* pointer(std::uintptr_t value) const noexcept {
+        // glibc relocates the pointers in the dynamic section, other C libraries keep them as offsets
+        return reinterpret_cast<const void*>(value < base_ ? base_ + value : value);
+    }
+
+    static std::size_t symbols_count_from_hash(const std::uint32_t* hash) noexcept {
+        return hash[1]; // `nchain` is equal to the count of symbols
+    }
+
+    static std::size_t symbols_count_from_gnu_hash(const std::uint32_t* hash) noexcept {
+        const std::uint32_t buckets_count = hash[0];
+        const std::uint32_t symbols_offset = hash[1];
+        const std::uint32_t bloom_size = hash[2];
+        const std::uint32_t* buckets = hash + 4 + bloom_size * (sizeof(address_t) / sizeof(std::uint32_t));
+        const std::uint32_t* chains = buckets + buckets_count;
+
+        std::uint32_t last = 0;
+        for (std::uint32_t i = 0; i < buckets_count; ++i) {
+            if (buckets[i] > last) {
+                last = buckets[i];
+            }
+        }
+
+        if (last < symbols_offset) {
+            return symbols_offset; // No symbols in the hash table
+        }
+
+        // Last element of each chain has the lowest bit set
+        while (!(chains[last - symbols_offset] & 1)) {
+            ++last;
+        }
+        return static_cast<std::size_t>(last) + 1;
+    }
+
+    static bool is_visible(const symbol_t& sym) noexcept {
+        const unsigned char visibility = (sym.st_other & 0x03);
+        // Same as the boost::dll::detail::elf_info::is_visible(), undefined symbols are imports
+        return (visibility == 0 /*STV_DEFAULT*/ || visibility == 3 /*STV_PROTECTED*/)
+                && (sym.st_info >> 4) != 0 /*STB_LOCAL*/ && !!sym.st_size && sym.st_shndx != SHN_UNDEF_;
+    }
+
+    std::vector<std::string> collect_symbols(std::size_t section_index) const {
+        std::vector<std::string> ret;
+        for (std::size_t i = 0; i < symbols_count_; ++i) {
+            const symbol_t& symbol = symbols_[i];
+            if (!is_visible(symbol) || symbol.st_name >= strings_size_) {
+                continue;
+            }
+
+            if (section_index && section_index != symbol.st_shndx) {
+                continue; // Not in the required section
+            }
+
+            const char* name = strings_ + symbol.st_name;
+            if (*name) {
+                ret.push_back(name);
+            }
+        }
+
+        return ret;
+    }
+
+    // Table does not change after it was read, so it is used without the lock
+    const sections_table_t& sections_table() const {
+        std::lock_guard<std::mutex> lock(sections_table_->mutex);
+        if (!sections_table_->read) {
+            std::ifstream fs;
+            fs.exceptions(
+                std::ios_base::failbit
+                | std::ifstream::badbit
+                | std::ifstream::eofbit
+            );
+            fs.open(path_.c_str(), std::ios_base::in | std::ios_base::binary);
+            boost::dll::detail::elf_info<address_t>::sections_table(fs, sections_table_->sections, sections_table_->names);
+            sections_table_->read = true;
+        }
+
+        return *sections_table_;
+    }
+
+    static const char* section_name(const section_t& section, const std::vector<char>& names) noexcept {
+        return section.sh_name < names.size() ? &names[section.sh_name] : "";
+    }
+
+public:
+    void init(void* handle, std::error_code& ec) {
+        const struct link_map* link_map = nullptr;
+#if BOOST_OS_BSD_FREE
+        if (dlinfo(handle, RTLD_DI_LINKMAP, &link_map) < 0) {
+            link_map = nullptr;
+        }
+#else
+        // Handle is a `struct link_map*`, see boost::dll::detail::path_from_handle()
+        link_map = static_cast<const struct link_map*>(handle);
+#endif
+        if (!link_map || !link_map->l_ld) {
+            ec = std::make_error_code(std::errc::bad_file_descriptor);
+            return;
+        }
+
+        base_ = static_cast<std::uintptr_t>(link_map->l_addr);
+        Dl_info info;
+        if (dladdr(const_cast<void*>(static_cast<const void*>(link_map->l_ld)), &info)) {
+            file_base_ = info.dli_fbase;
+        }
+        if (link_map->l_name && *link_map->l_name) {
+            path_ = link_map->l_name;
+        } else {
+            path_ = boost::dll::detail::program_location_impl(ec);
+            if (ec) {
+                return;
+            }
+        }
+
+        const std::uint32_t* hash = nullptr;
+        const std::uint32_t* gnu_hash = nullptr;
+        for (const ElfW(Dyn)* dyn = link_map->l_ld; dyn->d_tag != DT_NULL; ++dyn) {
+            switch (dyn->d_tag) {
+            case DT_SYMTAB:
+                symbols_ = static_cast<const symbol_t*>(pointer(dyn->d_un.d_ptr));
+                break;
+            case DT_STRTAB:
+                strings_ = static_cast<const char*>(pointer(dyn->d_un.d_ptr));
+                break;
+            case DT_STRSZ:
+                strings_size_ = static_cast<std::size_t>(dyn->d_un.d_val);
+                break;
+            case DT_HASH:
+                hash = static_cast<const std::uint32_t*>(pointer(dyn->d_un.d_ptr));
+                break;
+            case DT_GNU_HASH:
+                gnu_hash = static_cast<const std::uint32_t*>(pointer(dyn->d_un.d_ptr));
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (!symbols_ || !strings_) {
+            symbols_count_ = 0;
+        } else if (hash) {
+            symbols_count_ = symbols_count_from_hash(hash);
+        } else if (gnu_hash) {
+            symbols_count_ = symbols_count_from_gnu_hash(gnu_hash);
+        }
+    }
+
+    std::vector<std::string> sections() const {
+        std::vector<std::string> ret;
+
+        const sections_table_t& table = sections_table();
+        const std::vector<section_t>& sections = table.sections;
+        const std::vector<char>& names = table.names;
+
+        ret.reserve(sections.size());
+        for (std::size_t i = 0; i < sections.size(); ++i) {
+            ret.push_back(section_name(sections[i], names));
+            if (ret.back().empty()) {
+                ret.pop_back(); // Do not show empty names
+            }
+        }
+
+        return ret;
+    }
+
+    bool section(const char* name, const char*& data, std::size_t& size) const {
+        const sections_table_t& table = sections_table();
+        const std::vector<section_t>& sections = table.sections;
+        const std::vector<char>& names = table.names;
+
+        for (std::size_t i = 0; i < sections.size(); ++i) {
+            if (std::strcmp(section_name(sections[i], names), name)) {
+                continue;
+            }
+
+            if (!(sections[i].sh_flags & SHF_ALLOC_)) {
+                return false; // Section is not loaded into memory
+            }
+
+            data = reinterpret_cast<const char*>(base_ + static_cast<std::uintptr_t>(sections[i].sh_addr));
+            size = static_cast<std::size_t>(sections[i].sh_size);
+            return true;
+        }
+
+        return false;
+    }
+
+    // Checks that the address is inside of the image and not inside of one of its dependencies
+    bool contains(const void* address) const noexcept {
+        Dl_info info;
+        // Some of the libc headers miss `const` in `dladdr(const void*, Dl_info*)`
+        return file_base_ && dladdr(const_cast<void*>(address), &info) && info.dli_fbase == file_base_;
+    }
+
+    std::vector<std::string> symbols() const {
+        return collect_symbols(0);
+    }
+
+    std::vector<std::string> symbols(const char* section_name_to_find) const {
+        const sections_table_t& table = sections_table();
+        const std::vector<section_t>& sections = table.sections;
+        const std::vector<char>& names = table.names;
+
+        // Index 0 is the reserved null section
+        for (std::size_t i = 1; i < sections.size(); ++i) {
+            if (!std::strcmp(section_name(sections[i], names), section_name_to_find)) {
+                return collect_symbols(i);
+            }
+        }
+
+        return std::vector<std::string>();
+    }
+};
+
+#else
+
+// Platforms without usable in-memory information about the loaded binary: information is read from the file
+class loaded_image_impl {
+    boost::dll::fs::path    path_;
+
+public:
+    void init(void* handle, std::error_code& ec) {
+        path_ = boost::dll::detail::path_from_handle(handle, ec);
+    }
+
+    std::vector<std::string> sections() const {
+        boost::dll::library_info info(path_);
+        return info.sections();
+    }
+
+    bool section(const char* /*name*/, const char*& /*data*/, std::size_t& /*size*/) const {
+        return false; // Location of the section in memory is unknown
+    }
+
+    // Checks that the address is inside of the image and not inside of one of its dependencies
+    bool contains(const void* address) const noexcept {
+        Dl_info info;
+        // Some of the libc headers miss `const` in `dladdr(const void*, Dl_info*)`
+        if (!dladdr(const_cast<void*>(address), &info) || !info.dli_fname) {
+            return false;
+        }
+
+        boost::dll::fs::error_code ec;
+        return boost::dll::fs::equivalent(path_, boost::dll::fs::path(info.dli_fname), ec) && !ec;
+    }
+
+    std::vector<std::string> symbols() const {
+        boost::dll::library_info info(path_);
+        return info.symbols();
+    }
+
+    std::vector<std::string> symbols(const char* section_name) const {
+        boost::dll::library_info info(path_);
+        return info.symbols(section_name);
+    }
+};
+
+#endif
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_POSIX_LOADED_IMAGE_IMPL_HPP
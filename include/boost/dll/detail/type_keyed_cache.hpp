@@ -0,0 +1,68 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_TYPE_KEYED_CACHE_HPP
+#define BOOST_DLL_DETAIL_TYPE_KEYED_CACHE_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/type_index/ctti_type_index.hpp>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <utility>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+namespace boost { namespace dll { namespace detail {
+
+// Values resolved by the smart_library and the mangled storage, keyed by the type they were resolved for.
+// Entries are never removed, owners replace the whole cache when their symbols or type aliases change.
+class type_keyed_cache {
+    std::mutex mutex_;
+    std::map<boost::typeindex::ctti_type_index, boost::dll::detail::shared_ptr<const void>> values_;
+
+public:
+    type_keyed_cache() = default;
+    type_keyed_cache(const type_keyed_cache&) = delete;
+    type_keyed_cache& operator=(const type_keyed_cache&) = delete;
+
+    // Returns the cached value for the Key, calls `resolve` to get the value on the first request
+    template <class Key, class Value, class Resolver>
+    const Value& get(Resolver resolve) {
+        const boost::typeindex::ctti_type_index key = boost::typeindex::ctti_type_index::type_id<Key>();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto it = values_.find(key);
+            if (it != values_.end()) {
+                return *static_cast<const Value*>(it->second.get());
+            }
+        }
+
+        // Resolving without the lock, so that slow resolutions do not block each other
+        boost::dll::detail::shared_ptr<const void> value = boost::dll::detail::make_shared<Value>(resolve());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return *static_cast<const Value*>(values_.emplace(key, std::move(value)).first->second.get());
+    }
+
+    // Returns the count of the cached values
+    std::size_t size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return values_.size();
+    }
+};
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_TYPE_KEYED_CACHE_HPP
@@ -0,0 +1,158 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_WINDOWS_LOADED_IMAGE_IMPL_HPP
+#define BOOST_DLL_DETAIL_WINDOWS_LOADED_IMAGE_IMPL_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+#include <boost/dll/detail/pe_info.hpp>
+
+namespace boost { namespace dll { namespace detail {
+
+// HMODULE is the address of the image in memory, all the headers and the export table are mapped
+class loaded_image_impl {
+#ifdef _WIN64
+    using header_t = boost::dll::detail::IMAGE_NT_HEADERS_template<boost::dll::detail::ULONGLONG_>;
+#else
+    using header_t = boost::dll::detail::IMAGE_NT_HEADERS_template<boost::dll::detail::DWORD_>;
+#endif
+    using exports_t = boost::dll::detail::IMAGE_EXPORT_DIRECTORY_;
+    using section_t = boost::dll::detail::IMAGE_SECTION_HEADER_;
+    using dos_t = boost::dll::detail::IMAGE_DOS_HEADER_;
+
+    const char*         base_ = nullptr;
+    const header_t*     header_ = nullptr;
+
+    template <class T>
+    const T* at_rva(boost::dll::detail::DWORD_ rva) const noexcept {
+        return reinterpret_cast<const T*>(base_ + rva);
+    }
+
+    const section_t* section_headers() const noexcept {
+        return reinterpret_cast<const section_t*>(
+            reinterpret_cast<const char*>(header_)
+            + sizeof(boost::dll::detail::DWORD_)            // Signature
+            + sizeof(boost::dll::detail::IMAGE_FILE_HEADER_)
+            + header_->FileHeader.SizeOfOptionalHeader
+        );
+    }
+
+    static std::string section_name(const section_t& section) {
+        // There is no terminating null character if the name is exactly 8 characters long
+        const char* name = reinterpret_cast<const char*>(section.Name);
+        return std::string(name, ::strnlen(name, section_t::IMAGE_SIZEOF_SHORT_NAME_));
+    }
+
+    const section_t* find_section(const char* name) const {
+        const section_t* sections = section_headers();
+        for (std::size_t i = 0; i < header_->FileHeader.NumberOfSections; ++i) {
+            if (section_name(sections[i]) == name) {
+                return sections + i;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::vector<std::string> collect_symbols(const section_t* section) const {
+        std::vector<std::string> ret;
+
+        const boost::dll::detail::IMAGE_DATA_DIRECTORY_& exports_dir = header_->OptionalHeader.DataDirectory[0];
+        if (!exports_dir.VirtualAddress || !exports_dir.Size) {
+            return ret; // No exported symbols
+        }
+
+        const exports_t& exports = *at_rva<exports_t>(exports_dir.VirtualAddress);
+        const boost::dll::detail::DWORD_* names = at_rva<boost::dll::detail::DWORD_>(exports.AddressOfNames);
+        const boost::dll::detail::WORD_* ordinals = at_rva<boost::dll::detail::WORD_>(exports.AddressOfNameOrdinals);
+        const boost::dll::detail::DWORD_* functions = at_rva<boost::dll::detail::DWORD_>(exports.AddressOfFunctions);
+
+        ret.reserve(exports.NumberOfNames);
+        for (std::size_t i = 0; i < exports.NumberOfNames; ++i) {
+            if (section) {
+                const boost::dll::detail::DWORD_ rva = functions[ordinals[i]];
+                if (rva < section->VirtualAddress || rva >= section->VirtualAddress + section->Misc.VirtualSize) {
+                    continue; // Not in the required section
+                }
+            }
+
+            const char* name = at_rva<char>(names[i]);
+            if (*name) {
+                ret.push_back(name);
+            }
+        }
+
+        return ret;
+    }
+
+public:
+    void init(void* handle, std::error_code& ec) {
+        base_ = static_cast<const char*>(handle);
+        if (!base_) {
+            ec = std::make_error_code(std::errc::bad_file_descriptor);
+            return;
+        }
+
+        const dos_t& dos = *reinterpret_cast<const dos_t*>(base_);
+        header_ = at_rva<header_t>(static_cast<boost::dll::detail::DWORD_>(dos.e_lfanew));
+    }
+
+    std::vector<std::string> sections() const {
+        std::vector<std::string> ret;
+        const section_t* sections = section_headers();
+        ret.reserve(header_->FileHeader.NumberOfSections);
+        for (std::size_t i = 0; i < header_->FileHeader.NumberOfSections; ++i) {
+            ret.push_back(section_name(sections[i]));
+            if (ret.back().empty()) {
+                ret.pop_back(); // Do not show empty names
+            }
+        }
+        return ret;
+    }
+
+    bool section(const char* name, const char*& data, std::size_t& size) const {
+        const section_t* section = find_section(name);
+        if (!section) {
+            return false;
+        }
+
+        data = at_rva<char>(section->VirtualAddress);
+        size = section->Misc.VirtualSize;
+        return true;
+    }
+
+    std::vector<std::string> symbols() const {
+        return collect_symbols(nullptr);
+    }
+
+    std::vector<std::string> symbols(const char* section_name_to_find) const {
+        const section_t* section = find_section(section_name_to_find);
+        if (!section) {
+            return std::vector<std::string>();
+        }
+
+        return collect_symbols(section);
+    }
+};
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_WINDOWS_LOADED_IMAGE_IMPL_HPP
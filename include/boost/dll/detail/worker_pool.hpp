@@ -0,0 +1,101 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DLL_DETAIL_WORKER_POOL_HPP
+#define BOOST_DLL_DETAIL_WORKER_POOL_HPP
+
+#include <boost/dll/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <atomic>
+#include <cstddef>
+#include <system_error>
+#include <thread>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+namespace boost { namespace dll { namespace detail {
+
+// Returns the count of workers to use for `jobs_count` jobs. Zero `requested`
+// means "as many as the hardware supports".
+inline std::size_t workers_count(std::size_t requested, std::size_t jobs_count) noexcept {
+    if (!requested) {
+        requested = std::thread::hardware_concurrency();
+    }
+
+    if (requested > jobs_count) {
+        requested = jobs_count;
+    }
+
+    return requested ? requested : 1;
+}
+
+// Bounded pool of workers that pull job indexes from a shared counter. The calling thread
+// is one of the workers, so `run()` returns only after all the jobs were processed.
+//
+// `Worker` must be callable as `worker(worker_index, job_index)` and must not throw.
+class worker_pool {
+    std::atomic<std::size_t>    next_job_;
+    const std::size_t           jobs_count_;
+
+    template <class Worker>
+    void work(Worker& worker, std::size_t worker_index) noexcept {
+        for (;;) {
+            const std::size_t job = next_job_.fetch_add(1, std::memory_order_relaxed);
+            if (job >= jobs_count_) {
+                return;
+            }
+
+            worker(worker_index, job);
+        }
+    }
+
+public:
+    explicit worker_pool(std::size_t jobs_count) noexcept
+        : next_job_(0)
+        , jobs_count_(jobs_count)
+    {}
+
+    worker_pool(const worker_pool&) = delete;
+    worker_pool& operator=(const worker_pool&) = delete;
+
+    // Makes the workers skip all the jobs that were not started yet.
+    void stop() noexcept {
+        next_job_.store(jobs_count_, std::memory_order_relaxed);
+    }
+
+    template <class Worker>
+    void run(std::size_t workers, Worker& worker) {
+        std::vector<std::thread> threads;
+        threads.reserve(workers ? workers - 1 : 0);
+
+        for (std::size_t i = 1; i < workers; ++i) {
+            try {
+                threads.emplace_back([this, &worker, i]() { work(worker, i); });
+            } catch (const std::system_error&) {
+                // Out of system resources. Already started threads and the
+                // calling thread are enough to finish the jobs.
+                break;
+            }
+        }
+
+        work(worker, 0);
+
+        for (std::size_t i = 0; i < threads.size(); ++i) {
+            threads[i].join();
+        }
+    }
+};
+
+}}} // namespace boost::dll::detail
+
+#endif // BOOST_DLL_DETAIL_WORKER_POOL_HPP
@@ -0,0 +1,664 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/hot_reload.hpp
+/// \brief Contains the boost::dll::hot_reload_plugin and boost::dll::plugin_watcher classes for reloading
+/// of the changed plugins without restarting the process.
+
+#ifndef BOOST_DLL_HOT_RELOAD_HPP
+#define BOOST_DLL_HOT_RELOAD_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/shared_library.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/noncopyable.hpp>
+#include <boost/throw_exception.hpp>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+#include <boost/dll/detail/aggressive_ptr_cast.hpp>
+#include <boost/dll/detail/file_change_notifier.hpp>
+#include <boost/dll/detail/system_error.hpp>
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+template <class T>
+class reloadable_alias;
+
+/*!
+* \brief Plugin that could be reloaded from its changed file while its functions are being called.
+*
+* Each version of the plugin is a generation. Reload copies the file of the plugin to a distinct path and loads
+* the copy alongside the already loaded generations, so the new version gets its own copy of the code and the
+* static data. All the registered aliases are resolved in the new generation, then the generation is published
+* by a single atomic pointer swap.
+*
+* Callers access the plugin through boost::dll::reloadable_alias or pin(): they increment the reader count of the
+* current generation and never take locks. Previous generation is unloaded by reclaim() or by the next reload
+* only after all its readers have finished, so a function that is already running is never unloaded.
+*
+* Memory of the generation descriptors is reused but never freed before the destruction of the plugin, so that
+* the readers could always safely touch the reader count of a generation they have seen.
+*
+* The plugin must outlive all its boost::dll::reloadable_alias and pinned generations.
+*/
+class hot_reload_plugin: private boost::noncopyable {
+    /// @cond
+    struct loaded_copy {
+        boost::dll::shared_library      library;
+        boost::dll::fs::path            copy_path;
+
+        ~loaded_copy() {
+            library.unload();
+            boost::dll::fs::error_code ignore;
+            boost::dll::fs::remove(copy_path, ignore);
+        }
+    };
+
+    struct generation_data {
+        std::atomic<std::size_t>                        readers{0};
+        std::size_t                                     number = 0;
+        boost::dll::detail::shared_ptr<loaded_copy>     library;
+        std::vector<void*>                              symbols;    // by alias slot
+    };
+    /// @endcond
+
+public:
+    /*!
+    * \brief Pinned generation of the boost::dll::hot_reload_plugin, see boost::dll::hot_reload_plugin::pin().
+    *
+    * The generation is not unloaded while it is pinned.
+    */
+    class pinned {
+        generation_data* generation_;
+
+    public:
+        /// @cond
+        explicit pinned(generation_data* g) noexcept
+            : generation_(g)
+        {}
+
+        void* symbol(std::size_t slot) const noexcept {
+            return generation_->symbols[slot];
+        }
+        /// @endcond
+
+        pinned(const pinned&) = delete;
+        pinned& operator=(const pinned&) = delete;
+
+        /*!
+        * Move constructor.
+        * \throws Nothing.
+        */
+        pinned(pinned&& other) noexcept
+            : generation_(other.generation_)
+        {
+            other.generation_ = nullptr;
+        }
+
+        /*!
+        * Unpins the generation.
+        * \throws Nothing.
+        */
+        ~pinned() {
+            if (generation_) {
+                generation_->readers.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        /*!
+        * \return Number of the pinned generation. First loaded generation has number 1.
+        * \throws Nothing.
+        */
+        std::size_t generation() const noexcept {
+            return generation_->number;
+        }
+
+        /*!
+        * \return Library of the pinned generation.
+        * \throws Nothing.
+        */
+        const boost::dll::shared_library& library() const noexcept {
+            return generation_->library->library;
+        }
+    };
+
+private:
+    /// @cond
+    const boost::dll::fs::path                          path_;
+    const boost::dll::fs::path                          copies_directory_;
+    const load_mode::type                               mode_;
+
+    std::atomic<generation_data*>                       current_;
+    std::atomic<std::size_t>                            current_number_;
+
+    mutable std::mutex                                  mutex_;
+    std::vector<std::unique_ptr<generation_data> >      storage_;   // all the descriptors
+    std::vector<generation_data*>                       retired_;   // not current, may have readers
+    std::vector<generation_data*>                       free_;      // not current, no library
+    std::vector<std::string>                            names_;     // by alias slot
+    std::size_t                                         loads_ = 0;
+    std::uint64_t                                       file_time_ = 0;
+    std::uintmax_t                                      file_size_ = 0;
+
+    template <class FileTime>
+    static std::uint64_t file_time_to_integer(const FileTime& t) noexcept {
+        return static_cast<std::uint64_t>(t.time_since_epoch().count());
+    }
+
+    static std::uint64_t file_time_to_integer(std::time_t t) noexcept {
+        return static_cast<std::uint64_t>(t);
+    }
+
+    void file_state(std::uint64_t& time, std::uintmax_t& size, std::error_code& ec) const {
+        boost::dll::fs::error_code fs_ec;
+        size = boost::dll::fs::file_size(path_, fs_ec);
+        if (!fs_ec) {
+            time = file_time_to_integer(boost::dll::fs::last_write_time(path_, fs_ec));
+        }
+        if (fs_ec) {
+            ec = fs_ec;
+        }
+    }
+
+    // Readers increment the count and then check that the generation is still current. Writers
+    // replace the current generation and then check the count. With sequentially consistent operations
+    // either the writer sees the reader or the reader sees the replacement and backs off.
+    generation_data* enter() const noexcept {
+        for (;;) {
+            generation_data* const g = current_.load(std::memory_order_seq_cst);
+            g->readers.fetch_add(1, std::memory_order_seq_cst);
+            if (current_.load(std::memory_order_seq_cst) == g) {
+                return g;
+            }
+            g->readers.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    generation_data* allocate() {
+        if (!free_.empty()) {
+            generation_data* const g = free_.back();
+            free_.pop_back();
+            return g;
+        }
+
+        storage_.emplace_back(new generation_data());
+        return storage_.back().get();
+    }
+
+    std::size_t reclaim_locked() noexcept {
+        std::size_t unloaded = 0;
+        for (std::size_t i = 0; i < retired_.size();) {
+            generation_data* const g = retired_[i];
+            if (g->readers.load(std::memory_order_seq_cst)) {
+                ++i;
+                continue;
+            }
+
+            if (g->library.use_count() == 1) {
+                ++unloaded;
+            }
+            g->library.reset();
+            g->symbols.clear();
+            free_.push_back(g);
+            retired_[i] = retired_.back();
+            retired_.pop_back();
+        }
+
+        return unloaded;
+    }
+
+    void publish(generation_data* g, std::size_t number) noexcept {
+        g->number = number;
+        generation_data* const old = current_.exchange(g, std::memory_order_seq_cst);
+        current_number_.store(number, std::memory_order_relaxed);
+        if (old) {
+            retired_.push_back(old);
+        }
+        reclaim_locked();
+    }
+
+    // Adds the generation to the memory of the descriptors, so that publish() does not allocate
+    generation_data* prepare(boost::dll::detail::shared_ptr<loaded_copy> library, std::vector<void*> symbols) {
+        retired_.reserve(storage_.size() + 1);
+        free_.reserve(storage_.size() + 1);
+        generation_data* const g = allocate();
+        g->library = std::move(library);
+        g->symbols = std::move(symbols);
+        return g;
+    }
+
+    static void* resolve(const boost::dll::shared_library& lib, const std::string& name, std::error_code& ec) {
+        if (!lib.has(name)) {
+            ec = std::make_error_code(std::errc::invalid_argument);
+            return nullptr;
+        }
+
+        return lib.get<void*>(name);
+    }
+
+    boost::dll::detail::shared_ptr<loaded_copy> load_copy(std::error_code& ec) {
+        ++loads_;
+        boost::dll::fs::path copy = copies_directory_ / path_.stem();
+        copy += ".hot";
+        copy += std::to_string(reinterpret_cast<std::uintptr_t>(this));
+        copy += "_";
+        copy += std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+        copy += "_";
+        copy += std::to_string(loads_);
+        copy += path_.extension();
+
+        boost::dll::detail::shared_ptr<loaded_copy> ret = boost::dll::detail::make_shared<loaded_copy>();
+        ret->copy_path = copy;
+
+        boost::dll::fs::error_code fs_ec;
+        boost::dll::fs::copy_file(path_, copy, boost::dll::fs::copy_options::overwrite_existing, fs_ec);
+        if (fs_ec) {
+            ec = fs_ec;
+            return boost::dll::detail::shared_ptr<loaded_copy>();
+        }
+
+        ret->library.load(copy, ec, mode_);
+        if (ec) {
+            return boost::dll::detail::shared_ptr<loaded_copy>();
+        }
+
+        return ret;
+    }
+
+    bool reload_locked(std::error_code& ec) {
+        std::uint64_t time = 0;
+        std::uintmax_t size = 0;
+        file_state(time, size, ec);
+        if (ec) {
+            return false;
+        }
+
+        boost::dll::detail::shared_ptr<loaded_copy> library = load_copy(ec);
+        if (ec) {
+            return false;
+        }
+
+        std::vector<void*> symbols;
+        symbols.reserve(names_.size());
+        for (std::size_t i = 0; i < names_.size(); ++i) {
+            symbols.push_back(resolve(library->library, names_[i], ec));
+            if (ec) {
+                return false;
+            }
+        }
+
+        publish(prepare(std::move(library), std::move(symbols)), current_number_.load(std::memory_order_relaxed) + 1);
+        file_time_ = time;
+        file_size_ = size;
+        return true;
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Loads the first generation of the plugin.
+    *
+    * \param plugin_path Path to the plugin.
+    * \param mode A mode that will be used on plugin load.
+    * \param copies_directory Directory for the copies of the plugin. Must allow execution of the binaries from it.
+    * \throws \forcedlinkfs{system_error} if the plugin could not be copied or loaded, std::bad_alloc in case
+    * of insufficient memory.
+    */
+    explicit hot_reload_plugin(const boost::dll::fs::path& plugin_path, load_mode::type mode = load_mode::default_mode,
+        const boost::dll::fs::path& copies_directory = boost::dll::fs::temp_directory_path())
+        : path_(plugin_path)
+        , copies_directory_(copies_directory)
+        , mode_(mode)
+        , current_(nullptr)
+        , current_number_(0)
+    {
+        std::error_code ec;
+        reload(ec);
+        if (ec) {
+            boost::throw_exception(boost::dll::fs::system_error(ec, "boost::dll::hot_reload_plugin() failed"));
+        }
+    }
+
+    /*!
+    * Unloads all the generations. There must be no readers of the plugin.
+    * \throws Nothing.
+    */
+    ~hot_reload_plugin() = default;
+
+    /*!
+    * \return Path to the plugin.
+    * \throws Nothing.
+    */
+    const boost::dll::fs::path& location() const noexcept {
+        return path_;
+    }
+
+    /*!
+    * \return Number of the current generation. First loaded generation has number 1.
+    * \throws Nothing.
+    */
+    std::size_t generation() const noexcept {
+        return current_number_.load(std::memory_order_relaxed);
+    }
+
+    /*!
+    * \return Count of the loaded generations, including the current one.
+    * \throws Nothing.
+    */
+    std::size_t loaded_generations() const noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Generations that were published on alias registration share the library with the previous one
+        std::size_t ret = 0;
+        for (std::size_t i = 0; i < storage_.size(); ++i) {
+            const loaded_copy* const library = storage_[i]->library.get();
+            bool seen = !library;
+            for (std::size_t j = 0; j < i && !seen; ++j) {
+                seen = (storage_[j]->library.get() == library);
+            }
+            ret += !seen;
+        }
+        return ret;
+    }
+
+    /*!
+    * Pins the current generation, so that it is not unloaded until the returned object is destroyed.
+    * Does not take locks.
+    *
+    * \return Pinned generation.
+    * \throws Nothing.
+    */
+    pinned pin() const noexcept {
+        return pinned(enter());
+    }
+
+    /*!
+    * Copies and loads the file of the plugin, resolves all the registered aliases in it and makes it the current
+    * generation. On failure the current generation remains unchanged.
+    *
+    * \param ec Variable that will be set to the result of the operation.
+    * \return true if the new generation was published.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    bool reload(std::error_code& ec) {
+        ec.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        return reload_locked(ec);
+    }
+
+    /*!
+    * Same as reload(std::error_code&), but throws on failure.
+    *
+    * \throws \forcedlinkfs{system_error} if the plugin could not be copied, loaded or the registered alias is
+    * missing in the new version, std::bad_alloc in case of insufficient memory.
+    */
+    void reload() {
+        std::error_code ec;
+        reload(ec);
+        if (ec) {
+            boost::throw_exception(boost::dll::fs::system_error(ec, "boost::dll::hot_reload_plugin::reload() failed"));
+        }
+    }
+
+    /*!
+    * Reloads the plugin as reload(std::error_code&) does if the size or the modification time of the file changed
+    * since the last successful load.
+    *
+    * \param ec Variable that will be set to the result of the operation.
+    * \return true if the new generation was published.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    bool reload_if_changed(std::error_code& ec) {
+        ec.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::uint64_t time = 0;
+        std::uintmax_t size = 0;
+        file_state(time, size, ec);
+        if (ec || (time == file_time_ && size == file_size_)) {
+            return false;
+        }
+
+        return reload_locked(ec);
+    }
+
+    /*!
+    * Unloads the previous generations that have no readers.
+    *
+    * \return Count of the unloaded libraries.
+    * \throws Nothing.
+    */
+    std::size_t reclaim() noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return reclaim_locked();
+    }
+
+    /*!
+    * Registers the function alias, so that it is resolved in the current and in all the following generations.
+    *
+    * \b Template \b parameter \b T: Function type of the alias. Must be explicitly specified.
+    *
+    * \param alias_name Name of the alias.
+    * \return Callable that calls the function from the current generation.
+    * \throws \forcedlinkfs{system_error} if the alias does not exist in the current generation, std::bad_alloc
+    * in case of insufficient memory.
+    */
+    template <class T>
+    boost::dll::reloadable_alias<T> alias(const std::string& alias_name) {
+        static_assert(std::is_function<T>::value, "boost::dll::hot_reload_plugin::alias<T>() requires a function type");
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const std::vector<std::string>::const_iterator it = std::find(names_.begin(), names_.end(), alias_name);
+        const std::size_t slot = static_cast<std::size_t>(it - names_.begin());
+        if (it != names_.end()) {
+            return boost::dll::reloadable_alias<T>(*this, slot);
+        }
+
+        // Generations are immutable after publishing, so a new one that shares the library is published
+        generation_data* const current = current_.load(std::memory_order_relaxed);
+        std::error_code ec;
+        void* const symbol = resolve(current->library->library, alias_name, ec);
+        if (ec) {
+            boost::throw_exception(boost::dll::fs::system_error(ec, "boost::dll::hot_reload_plugin::alias() failed"));
+        }
+
+        std::vector<void*> symbols = current->symbols;
+        symbols.push_back(symbol);
+        names_.push_back(alias_name);
+        generation_data* g = nullptr;
+        try {
+            g = prepare(current->library, std::move(symbols));
+        } catch (...) {
+            names_.pop_back();
+            throw;
+        }
+
+        // Same library, same generation number
+        publish(g, current_number_.load(std::memory_order_relaxed));
+
+        return boost::dll::reloadable_alias<T>(*this, slot);
+    }
+};
+
+/*!
+* \brief Callable that calls the function alias from the current generation of the boost::dll::hot_reload_plugin,
+* see boost::dll::hot_reload_plugin::alias().
+*
+* Each call pins the current generation for the duration of the call with two atomic increments and no locks.
+*
+* \b Template \b parameter \b T: Function type of the alias.
+*/
+template <class T>
+class reloadable_alias {
+    const hot_reload_plugin*    plugin_;
+    std::size_t                 slot_;
+
+public:
+    /// @cond
+    reloadable_alias(const hot_reload_plugin& plugin, std::size_t slot) noexcept
+        : plugin_(&plugin)
+        , slot_(slot)
+    {}
+    /// @endcond
+
+    /*!
+    * Calls the function from the current generation of the plugin.
+    *
+    * \throws Any exception thrown by the function.
+    */
+    template <class... Args>
+    auto operator()(Args&&... args) const
+        -> decltype( (*static_cast<T*>(nullptr))(static_cast<Args&&>(args)...) )
+    {
+        const hot_reload_plugin::pinned generation = plugin_->pin();
+        return (*boost::dll::detail::aggressive_ptr_cast<T*>(generation.symbol(slot_)))(static_cast<Args&&>(args)...);
+    }
+};
+
+/*!
+* \brief Background watcher that reloads the changed boost::dll::hot_reload_plugin and unloads their
+* previous generations after the readers have finished.
+*
+* On Linux the directories of the plugins are watched with inotify, so a change is handled as soon as the
+* file is written. On other platforms the files are polled. In both cases the plugins are checked at least once
+* per poll interval. Failed reloads, for example of a partially written file, are retried on the next change.
+*/
+class plugin_watcher: private boost::noncopyable {
+    /// @cond
+    const std::chrono::milliseconds                 interval_;
+    boost::dll::detail::file_change_notifier        notifier_;
+    std::mutex                                      mutex_;
+    std::vector<std::pair<hot_reload_plugin*, int>> plugins_;   // plugin and the watch of its directory
+    std::atomic<bool>                               stop_;
+    std::thread                                     thread_;
+
+    void run() {
+        while (!stop_.load(std::memory_order_relaxed)) {
+            notifier_.wait(interval_);
+            if (stop_.load(std::memory_order_relaxed)) {
+                return;
+            }
+
+            try {
+                poll();
+            } catch (...) {
+                // Out of memory, retry on next iteration
+            }
+        }
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Starts the watcher thread.
+    *
+    * \param poll_interval Maximal time between the checks of the plugins.
+    * \throws std::system_error if the thread could not be started.
+    */
+    explicit plugin_watcher(std::chrono::milliseconds poll_interval = std::chrono::milliseconds(1000))
+        : interval_(poll_interval)
+        , stop_(false)
+        , thread_([this]() { run(); })
+    {}
+
+    /*!
+    * Stops the watcher thread.
+    * \throws Nothing.
+    */
+    ~plugin_watcher() {
+        stop_.store(true, std::memory_order_relaxed);
+        notifier_.interrupt();
+        thread_.join();
+    }
+
+    /*!
+    * Starts watching the plugin. The plugin must outlive the watcher or must be unwatched before its destruction.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    void watch(hot_reload_plugin& plugin) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        plugins_.reserve(plugins_.size() + 1);
+
+        boost::dll::fs::path directory = plugin.location().parent_path();
+        if (directory.empty()) {
+            directory = ".";
+        }
+        plugins_.emplace_back(&plugin, notifier_.add_directory(directory));
+    }
+
+    /*!
+    * Stops watching the plugin. After return the watcher does not access the plugin.
+    * \throws Nothing.
+    */
+    void unwatch(hot_reload_plugin& plugin) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::size_t i = plugins_.size(); i > 0; --i) {
+            if (plugins_[i - 1].first == &plugin) {
+                notifier_.remove_directory(plugins_[i - 1].second);
+                plugins_.erase(plugins_.begin() + static_cast<std::ptrdiff_t>(i - 1));
+            }
+        }
+    }
+
+    /*!
+    * Checks all the watched plugins immediately, reloads the changed ones and unloads the previous
+    * generations that have no readers.
+    *
+    * \return Count of the reloaded plugins.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    std::size_t poll() {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::size_t reloaded = 0;
+        for (std::size_t i = 0; i < plugins_.size(); ++i) {
+            std::error_code ec;
+            if (plugins_[i].first->reload_if_changed(ec)) {
+                ++reloaded;
+            }
+            plugins_[i].first->reclaim();
+        }
+
+        return reloaded;
+    }
+};
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#endif // BOOST_DLL_HOT_RELOAD_HPP
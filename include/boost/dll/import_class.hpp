@@ -23,14 +23,26 @@
 #endif
 
 #if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/assert.hpp>
+
 #if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <new>
+#include <string>
+#include <system_error>
+#include <typeinfo>
 #include <utility>  // std::move
+#include <vector>
 #endif // !defined(BOOST_DLL_USE_STD_MODULE)
 #endif // !defined(BOOST_DLL_INTERFACE_UNIT)
 
 #include <boost/dll/smart_library.hpp>
 #include <boost/dll/import_mangled.hpp>
+#include <boost/dll/runtime_symbol_info.hpp>
 
 #if (__cplusplus < 201103L) && (!defined(_MSVC_LANG) || _MSVC_LANG < 201103L)
 #  error This file requires C++11 at least!
@@ -41,14 +53,122 @@ namespace boost { namespace dll { namespace experimental {
 namespace detail
 {
 
+//type erased allocator of the memory for the objects constructed by the standard constructor, new[] by default
+struct storage_allocator
+{
+    void * allocator;
+    void * (*allocate_fn)(void * allocator, std::size_t size);
+    void   (*deallocate_fn)(void * allocator, void * p, std::size_t size);
+
+    storage_allocator() noexcept
+        : allocator(nullptr), allocate_fn(nullptr), deallocate_fn(nullptr) {}
+
+    template<class Allocator>
+    explicit storage_allocator(Allocator & alloc) noexcept
+        : allocator(std::addressof(alloc)), allocate_fn(&allocate_with<Allocator>), deallocate_fn(&deallocate_with<Allocator>)
+    {
+        static_assert(sizeof(typename std::allocator_traits<Allocator>::value_type) == 1,
+            "Allocator must allocate bytes, for example std::allocator<char>");
+    }
+
+    void * allocate(std::size_t size) const
+    {
+        return allocate_fn ? allocate_fn(allocator, size) : new char[size];
+    }
+
+    void deallocate(void * p, std::size_t size) const noexcept
+    {
+        if (deallocate_fn)
+            deallocate_fn(allocator, p, size);
+        else
+            delete [] static_cast<char*>(p);
+    }
+
+private:
+    template<class Allocator>
+    static void * allocate_with(void * allocator, std::size_t size)
+    {
+        typedef std::allocator_traits<Allocator> traits;
+        return traits::allocate(*static_cast<Allocator*>(allocator), size);
+    }
+
+    template<class Allocator>
+    static void deallocate_with(void * allocator, void * p, std::size_t size)
+    {
+        typedef std::allocator_traits<Allocator> traits;
+        traits::deallocate(*static_cast<Allocator*>(allocator),
+            static_cast<typename traits::value_type*>(p), size);
+    }
+};
+
+template<class T, class = void>
+class virtual_mem_fn;
+
+//calls the function from the slot of the vtable of the object, i.e. the final overrider
+template<class T, class Return, class ...Args>
+class virtual_mem_fn<T, Return(Args...)>
+{
+    typedef typename boost::dll::detail::get_mem_fn_type<T, Return(Args...)>::mem_fn mem_fn_t;
+
+    std::size_t index_;
+
+public:
+    explicit virtual_mem_fn(std::size_t index) noexcept
+        : index_(index) {}
+
+    //index of the slot in the vtable
+    std::size_t index() const noexcept {return index_;}
+
+    Return operator()(T *t, Args...args) const
+    {
+        const void * const * vtable;
+        std::memcpy(&vtable, const_cast<const void*>(static_cast<const volatile void*>(t)), sizeof(vtable));
+
+        const mem_fn_t mem_fn = boost::dll::detail::aggressive_ptr_cast<mem_fn_t>(const_cast<void*>(vtable[index_]));
+        return (t->*mem_fn)(static_cast<Args>(args)...);
+    }
+};
+
+//iterator over objects laid out with the size of the imported class, that may differ from sizeof(T)
+template<typename T>
+class strided_iterator
+{
+    char * p_;
+    std::size_t stride_;
+
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T * pointer;
+    typedef T & reference;
+
+    strided_iterator() noexcept : p_(nullptr), stride_(0) {}
+    strided_iterator(char * p, std::size_t stride) noexcept : p_(p), stride_(stride) {}
+
+    reference operator*()  const noexcept {return *reinterpret_cast<T*>(p_);}
+    pointer   operator->() const noexcept {return  reinterpret_cast<T*>(p_);}
+
+    strided_iterator & operator++() noexcept {p_ += stride_; return *this;}
+    strided_iterator   operator++(int) noexcept {strided_iterator tmp(*this); p_ += stride_; return tmp;}
+
+    bool operator==(const strided_iterator & rhs) const noexcept {return p_ == rhs.p_;}
+    bool operator!=(const strided_iterator & rhs) const noexcept {return p_ != rhs.p_;}
+};
+
 template<typename T>
 struct deleter
 {
     destructor<T> dtor;
     bool use_deleting;
+    storage_allocator storage;
+    std::size_t size;
 
     deleter(const destructor<T> & dtor, bool use_deleting = false) :
-        dtor(dtor), use_deleting(use_deleting) {}
+        dtor(dtor), use_deleting(use_deleting), storage(), size(0) {}
+
+    deleter(const destructor<T> & dtor, const storage_allocator & storage, std::size_t size) :
+        dtor(dtor), use_deleting(false), storage(storage), size(size) {}
 
     void operator()(T*t)
     {
@@ -57,9 +177,7 @@ struct deleter
         else
         {
             dtor.call_standard(t);
-            //the thing is actually an array, so delete[]
-            auto p = reinterpret_cast<char*>(t);
-            delete [] p;
+            storage.deallocate(t, size);
         }
     }
 };
@@ -106,6 +224,26 @@ struct mem_fn_call_proxy<T, Return(Args...)>
     }
 };
 
+template<class T, class = void>
+struct bound_mem_fn;
+
+template<class T, class Return, class ...Args>
+struct bound_mem_fn<T, Return(Args...)>
+{
+    typedef typename boost::dll::detail::get_mem_fn_type<T, Return(Args...)>::mem_fn mem_fn_t;
+
+    T* t;
+    mem_fn_t mem_fn;
+
+    bound_mem_fn(T *t, mem_fn_t mem_fn) noexcept
+        : t(t), mem_fn(mem_fn) {}
+
+    Return operator()(Args...args) const
+    {
+        return (t->*mem_fn)(static_cast<Args>(args)...);
+    }
+};
+
 }
 
 BOOST_DLL_BEGIN_MODULE_EXPORT
@@ -122,6 +260,14 @@ import_class(const smart_library& lib, std::size_t size, Args...args);
 template<typename T, typename ... Args> imported_class<T>
 import_class(const smart_library& lib, std::size_t size,
              const std::string & alias_name, Args...args);
+template<typename T, typename ... Args, typename Allocator> imported_class<T>
+import_class(const smart_library& lib, std::allocator_arg_t, Allocator& alloc, std::size_t size, Args...args);
+
+template<typename T>
+class imported_class_array;
+
+template<typename T, typename ... Args> imported_class_array<T>
+import_class_array(const smart_library& lib, std::size_t size, std::size_t count, Args...args);
 
 
 /*! This class represents an imported class.
@@ -142,19 +288,22 @@ class imported_class
     template<typename ... Args>
     inline std::unique_ptr<T, detail::deleter<T>> make_data(const smart_library& lib, Args ... args);
     template<typename ... Args>
-    inline std::unique_ptr<T, detail::deleter<T>> make_data(const smart_library& lib, std::size_t size, Args...args);
+    inline std::unique_ptr<T, detail::deleter<T>> make_data(const smart_library& lib,
+            const detail::storage_allocator& storage, std::size_t size, Args...args);
 
     template<typename ...Args>
     imported_class(detail::sequence<Args...> *, const smart_library& lib,  Args...args);
 
     template<typename ...Args>
-    imported_class(detail::sequence<Args...> *, const smart_library& lib, std::size_t size,  Args...args);
+    imported_class(detail::sequence<Args...> *, const smart_library& lib,
+            const detail::storage_allocator& storage, std::size_t size,  Args...args);
 
     template<typename ...Args>
     imported_class(detail::sequence<Args...> *, smart_library&& lib,  Args...args);
 
     template<typename ...Args>
-    imported_class(detail::sequence<Args...> *, smart_library&& lib, std::size_t size,  Args...args);
+    imported_class(detail::sequence<Args...> *, smart_library&& lib,
+            const detail::storage_allocator& storage, std::size_t size,  Args...args);
 public:
     //alias to construct with explicit parameter list
     template<typename ...Args>
@@ -168,7 +317,14 @@ public:
     static imported_class<T> make(smart_library&& lib, std::size_t size,  Args...args)
     {
         typedef detail::sequence<Args...> *seq;
-        return imported_class(seq(), std::move(lib), size, static_cast<Args>(args)...);
+        return imported_class(seq(), std::move(lib), detail::storage_allocator(), size, static_cast<Args>(args)...);
+    }
+
+    template<typename ...Args>
+    static imported_class<T> make(smart_library&& lib, const detail::storage_allocator& storage, std::size_t size,  Args...args)
+    {
+        typedef detail::sequence<Args...> *seq;
+        return imported_class(seq(), std::move(lib), storage, size, static_cast<Args>(args)...);
     }
     template<typename ...Args>
     static imported_class<T> make(const smart_library& lib,  Args...args)
@@ -181,7 +337,14 @@ public:
     static imported_class<T> make(const smart_library& lib, std::size_t size,  Args...args)
     {
         typedef detail::sequence<Args...> *seq;
-        return imported_class(seq(), lib, size, static_cast<Args>(args)...);
+        return imported_class(seq(), lib, detail::storage_allocator(), size, static_cast<Args>(args)...);
+    }
+
+    template<typename ...Args>
+    static imported_class<T> make(const smart_library& lib, const detail::storage_allocator& storage, std::size_t size,  Args...args)
+    {
+        typedef detail::sequence<Args...> *seq;
+        return imported_class(seq(), lib, storage, size, static_cast<Args>(args)...);
     }
 
     typedef imported_class<T> base_t;
@@ -195,13 +358,13 @@ public:
     imported_class& operator=(imported_class&&) = default;  ///<Move assignmend
 
     ///Check if the imported class is move-constructible
-    bool is_move_constructible() {return !lib_.symbol_storage().template get_constructor<T(T&&)>     ().empty();}
+    bool is_move_constructible() const {return !lib_.symbol_storage().template get_constructor<T(T&&)>     ().empty();}
     ///Check if the imported class is move-assignable
-    bool is_move_assignable()    {return !lib_.symbol_storage().template get_mem_fn<T, T&(T&&)>     ("operator=").empty();}
+    bool is_move_assignable() const    {return !lib_.symbol_storage().template get_mem_fn<T, T&(T&&)>     ("operator=").empty();}
     ///Check if the imported class is copy-constructible
-    bool is_copy_constructible() {return !lib_.symbol_storage().template get_constructor<T(const T&)>().empty();}
+    bool is_copy_constructible() const {return !lib_.symbol_storage().template get_constructor<T(const T&)>().empty();}
     ///Check if the imported class is copy-assignable
-    bool is_copy_assignable()    {return !lib_.symbol_storage().template get_mem_fn<T, T&(const T&)>("operator=").empty();}
+    bool is_copy_assignable() const    {return !lib_.symbol_storage().template get_mem_fn<T, T&(const T&)>("operator=").empty();}
 
     imported_class<T> copy() const; ///<Invoke the copy constructor. \attention Undefined behaviour if the imported object is not copy constructible.
     imported_class<T> move();       ///<Invoke the move constructor. \attention Undefined behaviour if the imported object is not move constructible.
@@ -244,6 +407,41 @@ public:
     {
         return detail::mem_fn_call_proxy<Tin, Signature>(data_.get(), name, lib_);
     }
+    /*! Resolve a member function once and bind it to the object. Unlike call() the returned handle
+     * does not search for the function on each invocation, calling it costs as much as calling a member function
+     * through a pointer.
+     *
+     * The handle is valid while this object exists.
+     *
+     * \b Example
+     *
+     * \code
+     * auto set = im_class.bind<void(int)>("function_name");
+     * for (int i = 0; i < 100; ++i) set(i);
+     * \endcode
+     *
+     * \throw \forcedlinkfs{system_error} if the function does not exist.
+     */
+    template<class Signature>
+    detail::bound_mem_fn<T, Signature> bind(const std::string& name)
+    {
+        return detail::bound_mem_fn<T, Signature>(data_.get(), lib_.get_mem_fn<T, Signature>(name));
+    }
+    /*! Resolve a qualified member function once and bind it to the object, i.e. const and or volatile.
+     *
+     * \b Example
+     *
+     * \code
+     * auto get = im_class.bind<const type_alias, int()>("function_name");
+     * \endcode
+     *
+     * \throw \forcedlinkfs{system_error} if the function does not exist.
+     */
+    template<class Tin, class Signature, class = boost::enable_if<detail::unqalified_is_same<T, Tin>>>
+    detail::bound_mem_fn<Tin, Signature> bind(const std::string& name)
+    {
+        return detail::bound_mem_fn<Tin, Signature>(data_.get(), lib_.get_mem_fn<Tin, Signature>(name));
+    }
     ///Overload of ->* for an imported method.
     template<class Tin, class T2>
     const detail::mem_fn_call_proxy<Tin, boost::dll::experimental::detail::mangled_library_mem_fn<Tin, T2>>
@@ -261,6 +459,339 @@ public:
     }
 };
 
+/*! Pool of memory for the imported objects, that could be passed as an allocator to
+ * \ref boost::dll::experimental::import_class(const smart_library& lib, std::allocator_arg_t, Allocator&, std::size_t, Args...).
+ *
+ * Memory is split into size classes, each size class is allocated in blocks of several objects and keeps a list of
+ * the freed objects. Allocation and deallocation of an object is a few pointer operations, memory is returned to
+ * the system only on destruction of the pool.
+ *
+ * \note The pool is not thread safe and it must outlive all the objects allocated from it.
+ */
+class imported_class_pool
+{
+    struct free_slot
+    {
+        free_slot * next;
+    };
+
+    struct size_class
+    {
+        std::size_t size;
+        free_slot * free;
+    };
+
+    std::size_t             objects_per_block_;
+    std::vector<size_class> classes_;
+    std::vector<void*>      blocks_;
+
+    static std::size_t slot_size(std::size_t size) noexcept
+    {
+        const std::size_t alignment = alignof(std::max_align_t);
+        if (size < sizeof(free_slot))
+            size = sizeof(free_slot);
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    size_class * find(std::size_t slot) noexcept
+    {
+        for (auto & c : classes_)
+            if (c.size == slot)
+                return &c;
+        return nullptr;
+    }
+
+    void grow(size_class & c)
+    {
+        blocks_.reserve(blocks_.size() + 1);
+        char * block = static_cast<char*>(::operator new(c.size * objects_per_block_));
+        blocks_.push_back(block);
+
+        for (std::size_t i = objects_per_block_; i-- > 0;)
+        {
+            free_slot * s = reinterpret_cast<free_slot*>(block + i * c.size);
+            s->next = c.free;
+            c.free = s;
+        }
+    }
+
+public:
+    typedef char value_type;
+
+    /*! Creates an empty pool.
+     *
+     * \param objects_per_block Count of objects of the same size class that are allocated from the system at once.
+     */
+    explicit imported_class_pool(std::size_t objects_per_block = 64) noexcept
+        : objects_per_block_(objects_per_block ? objects_per_block : 1) {}
+
+    imported_class_pool(const imported_class_pool &) = delete;
+    imported_class_pool& operator=(const imported_class_pool &) = delete;
+
+    ~imported_class_pool()
+    {
+        for (void * b : blocks_)
+            ::operator delete(b);
+    }
+
+    /*! Allocates memory for an object, aligned as std::max_align_t.
+     *
+     * \param size Size of the object.
+     * \throw std::bad_alloc in case of insufficient memory.
+     */
+    char * allocate(std::size_t size)
+    {
+        const std::size_t slot = slot_size(size);
+        size_class * c = find(slot);
+        if (!c)
+        {
+            classes_.push_back(size_class{slot, nullptr});
+            c = &classes_.back();
+        }
+
+        if (!c->free)
+            grow(*c);
+
+        free_slot * s = c->free;
+        c->free = s->next;
+        return reinterpret_cast<char*>(s);
+    }
+
+    /*! Returns the memory of the object to the pool.
+     *
+     * \param p Memory returned by allocate().
+     * \param size Size that was passed to allocate().
+     */
+    void deallocate(char * p, std::size_t size) noexcept
+    {
+        size_class * c = find(slot_size(size));
+        BOOST_ASSERT_MSG(c, "Memory was not allocated from this pool");
+
+        free_slot * s = reinterpret_cast<free_slot*>(p);
+        s->next = c->free;
+        c->free = s;
+    }
+};
+
+/*! This class represents an array of instances of an imported class, that are stored contiguously in memory.
+ *
+ * Constructor and destructor are resolved once for the whole array. Objects are laid out with a stride equal
+ * to the size of the class, that is always a multiple of the alignment of the class, in memory aligned as
+ * std::max_align_t.
+ *
+ * \note It must be constructed via \ref boost::dll::import_class_array(const smart_library& lib, std::size_t, std::size_t, Args...)
+ *
+ * \tparam The type or type-alias of the imported class.
+ */
+template<typename T>
+class imported_class_array
+{
+    smart_library lib_;
+    destructor<T> dtor_;
+    std::size_t size_;
+    std::size_t count_;
+    std::unique_ptr<char[]> data_;
+
+    void destroy() noexcept
+    {
+        while (count_)
+        {
+            --count_;
+            dtor_.call_standard(reinterpret_cast<T*>(data_.get() + count_ * size_));
+        }
+    }
+
+    template<typename ...Args>
+    imported_class_array(detail::sequence<Args...> *, const smart_library& lib, std::size_t size, std::size_t count, Args...args);
+
+public:
+    typedef detail::strided_iterator<T> iterator;
+    typedef detail::strided_iterator<const T> const_iterator;
+
+    //alias to construct with explicit parameter list
+    template<typename ...Args>
+    static imported_class_array<T> make(const smart_library& lib, std::size_t size, std::size_t count, Args...args)
+    {
+        typedef detail::sequence<Args...> *seq;
+        return imported_class_array(seq(), lib, size, count, static_cast<Args>(args)...);
+    }
+
+    imported_class_array() = delete;
+
+    imported_class_array(imported_class_array&) = delete;
+    imported_class_array(imported_class_array&& other) noexcept ///<Move constructor
+        : lib_(std::move(other.lib_)), dtor_(other.dtor_), size_(other.size_), count_(other.count_), data_(std::move(other.data_))
+    {
+        other.count_ = 0;
+    }
+    imported_class_array& operator=(imported_class_array&) = delete;
+
+    ///Destroys the objects in the reverse order of construction.
+    ~imported_class_array() {destroy();}
+
+    ///Count of the objects.
+    std::size_t size() const noexcept {return count_;}
+    ///Check if there are no objects.
+    bool empty() const noexcept {return !count_;}
+    ///Distance in bytes between the objects, i.e. the size of the class.
+    std::size_t stride() const noexcept {return size_;}
+
+    ///Get a reference to the object at position i.
+    T & operator[](std::size_t i) noexcept
+    {
+        BOOST_ASSERT(i < count_);
+        return *reinterpret_cast<T*>(data_.get() + i * size_);
+    }
+    ///Get a const reference to the object at position i.
+    const T & operator[](std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < count_);
+        return *reinterpret_cast<const T*>(data_.get() + i * size_);
+    }
+
+    iterator begin() noexcept {return iterator(data_.get(), size_);}
+    iterator end()   noexcept {return iterator(data_.get() + count_ * size_, size_);}
+    const_iterator begin() const noexcept {return const_iterator(data_.get(), size_);}
+    const_iterator end()   const noexcept {return const_iterator(data_.get() + count_ * size_, size_);}
+
+    /*! Resolve a member function once, to call it on each of the objects.
+     *
+     * \b Example
+     *
+     * \code
+     * auto set = arr.get_mem_fn<void(int)>("set");
+     * for (auto& obj : arr) (obj.*set)(42);
+     * \endcode
+     *
+     * \throw \forcedlinkfs{system_error} if the function does not exist.
+     */
+    template<class Signature>
+    typename boost::dll::detail::get_mem_fn_type<T, Signature>::mem_fn get_mem_fn(const std::string& name) const
+    {
+        return lib_.get_mem_fn<T, Signature>(name);
+    }
+    ///Resolve a qualified member function once, i.e. const and or volatile.
+    template<class Tin, class Signature, class = boost::enable_if<detail::unqalified_is_same<T, Tin>>>
+    typename boost::dll::detail::get_mem_fn_type<Tin, Signature>::mem_fn get_mem_fn(const std::string& name) const
+    {
+        return lib_.get_mem_fn<Tin, Signature>(name);
+    }
+};
+
+/*! This class represents the vtable of an imported class, that allows to call virtual functions without
+ * the lookups by name on each call.
+ *
+ * The vtable and the type info are loaded once on construction. Each virtual function is resolved once by
+ * get(), that finds the slot of the function in the vtable. Calling the returned object loads the function from
+ * the vtable of the object and calls it, so the calls are dispatched to the final overrider as usual virtual calls.
+ *
+ * Only the functions from the primary vtable are supported, i.e. the functions that are not introduced by
+ * the second and following bases of the class.
+ *
+ * \b Example
+ *
+ * \code
+ * imported_vtable<class type_alias> vtable(lib);
+ * auto func = vtable.get<int(int, int)>("func");
+ * for (auto& obj : objects) func(obj.get(), 1, 2);
+ * \endcode
+ *
+ * \tparam The type or type-alias of the imported class.
+ */
+template<typename T>
+class imported_vtable
+{
+    smart_library lib_;
+    const void * const * slots_;
+    const std::type_info * ti_;
+
+    bool find_slot(const void * function, std::size_t & index) const
+    {
+        // Size of the vtable is unknown, so the search stops on the first value that is not a pointer into
+        // a loaded binary, on the type info of the next vtable of the group or after a sane count of slots
+        const std::size_t max_slots = 4096;
+        for (index = 0; index < max_slots && slots_[index]; ++index)
+        {
+            if (slots_[index] == function)
+                return true;
+
+            if (slots_[index] == static_cast<const void*>(ti_))
+                return false;
+
+            std::error_code ec;
+            boost::dll::symbol_location_ptr(slots_[index], ec);
+            if (ec)
+                return false;
+        }
+
+        return false;
+    }
+
+public:
+    /*! Loads the vtable and the type info of the class.
+     *
+     * \param lib Shared library with the class. A copy is stored, so no added type_aliases will be visible.
+     * \throw \forcedlinkfs{system_error} if the class has no vtable or the DLL/DSO was not loaded,
+     *       std::bad_alloc in case of insufficient memory.
+     */
+    explicit imported_vtable(const smart_library& lib)
+        : lib_(lib), slots_(nullptr), ti_(nullptr)
+    {
+        const std::string vtable_name = lib_.symbol_storage().get_vtable<T>();
+        if (vtable_name.empty())
+        {
+            boost::throw_exception(
+                boost::dll::fs::system_error(
+                    std::make_error_code(std::errc::invalid_argument), "boost::dll::imported_vtable() failed: no vtable was found"
+                )
+            );
+        }
+
+        slots_ = &lib_.shared_lib().get<const void * const>(vtable_name);
+#if !defined(_MSC_VER)
+        // Itanium C++ ABI: offset to top and type info precede the function pointers
+        slots_ += 2;
+#endif
+        ti_ = &lib_.get_type_info<T>();
+    }
+
+    ///Get the type info of the class.
+    const std::type_info& get_type_info() const noexcept {return *ti_;}
+
+    /*! Resolve a virtual member function and find its slot in the vtable.
+     *
+     * \throw \forcedlinkfs{system_error} if the function does not exist or is not in the vtable.
+     */
+    template<class Signature>
+    detail::virtual_mem_fn<T, Signature> get(const std::string& name) const
+    {
+        return get<T, Signature>(name);
+    }
+    ///Resolve a qualified virtual member function, i.e. const and or volatile.
+    template<class Tin, class Signature, class = boost::enable_if<detail::unqalified_is_same<T, Tin>>>
+    detail::virtual_mem_fn<Tin, Signature> get(const std::string& name) const
+    {
+        typedef typename boost::dll::detail::get_mem_fn_type<Tin, Signature>::mem_fn mem_fn_t;
+        const mem_fn_t mem_fn = lib_.get_mem_fn<Tin, Signature>(name);
+
+        // smart_library stores the address of the function into the beginning of the member pointer
+        const void * function;
+        std::memcpy(&function, &mem_fn, sizeof(function));
+
+        std::size_t index = 0;
+        if (!find_slot(function, index))
+        {
+            boost::throw_exception(
+                boost::dll::fs::system_error(
+                    std::make_error_code(std::errc::invalid_argument), "boost::dll::imported_vtable::get() failed: function is not virtual"
+                )
+            );
+        }
+
+        return detail::virtual_mem_fn<Tin, Signature>(index);
+    }
+};
+
 BOOST_DLL_END_MODULE_EXPORT
 
 
@@ -294,7 +825,8 @@ inline std::unique_ptr<T, detail::deleter<T>> imported_class<T>::make_data(const
 //helper function, using the standard
 template<typename T>
 template<typename ... Args>
-inline std::unique_ptr<T, detail::deleter<T>> imported_class<T>::make_data(const smart_library& lib, std::size_t size, Args...args)
+inline std::unique_ptr<T, detail::deleter<T>> imported_class<T>::make_data(const smart_library& lib,
+        const detail::storage_allocator& storage, std::size_t size, Args...args)
 {
     constructor<T(Args...)> ctor = lib.get_constructor<T(Args...)>();
     destructor<T>           dtor = lib.get_destructor <T>();
@@ -313,13 +845,19 @@ inline std::unique_ptr<T, detail::deleter<T>> imported_class<T>::make_data(const
         );
     }
 
-    T *data = reinterpret_cast<T*>(new char[size]);
+    void *memory = storage.allocate(size);
+    T *data = static_cast<T*>(memory);
 
-    ctor.call_standard(data, static_cast<Args>(args)...);
+    try {
+        ctor.call_standard(data, static_cast<Args>(args)...);
+    } catch (...) {
+        storage.deallocate(memory, size);
+        throw;
+    }
 
     return std::unique_ptr<T, detail::deleter<T>> (
-            reinterpret_cast<T*>(data),
-            detail::deleter<T>(dtor, false /* not deleting dtor*/));
+            data,
+            detail::deleter<T>(dtor, storage, size));
 
 }
 
@@ -329,7 +867,7 @@ template<typename ...Args>
 imported_class<T>::imported_class(detail::sequence<Args...> *, const smart_library & lib,  Args...args)
     : lib_(lib),
       data_(make_data<Args...>(lib_, static_cast<Args>(args)...)),
-      is_allocating_(false),
+      is_allocating_(true),
       size_(0),
       ti_(lib.get_type_info<T>())
 {
@@ -338,10 +876,11 @@ imported_class<T>::imported_class(detail::sequence<Args...> *, const smart_libra
 
 template<typename T>
 template<typename ...Args>
-imported_class<T>::imported_class(detail::sequence<Args...> *, const smart_library & lib, std::size_t size,  Args...args)
+imported_class<T>::imported_class(detail::sequence<Args...> *, const smart_library & lib,
+        const detail::storage_allocator & storage, std::size_t size,  Args...args)
     : lib_(lib),
-      data_(make_data<Args...>(lib_, size, static_cast<Args>(args)...)),
-      is_allocating_(true),
+      data_(make_data<Args...>(lib_, storage, size, static_cast<Args>(args)...)),
+      is_allocating_(false),
       size_(size),
       ti_(lib.get_type_info<T>())
 {
@@ -353,23 +892,63 @@ template<typename ...Args>
 imported_class<T>::imported_class(detail::sequence<Args...> *, smart_library && lib,  Args...args)
     : lib_(std::move(lib)),
       data_(make_data<Args...>(lib_, static_cast<Args>(args)...)),
-      is_allocating_(false),
+      is_allocating_(true),
       size_(0),
-      ti_(lib.get_type_info<T>())
+      ti_(lib_.get_type_info<T>())
 {
 
 }
 
 template<typename T>
 template<typename ...Args>
-imported_class<T>::imported_class(detail::sequence<Args...> *, smart_library && lib, std::size_t size,  Args...args)
+imported_class<T>::imported_class(detail::sequence<Args...> *, smart_library && lib,
+        const detail::storage_allocator & storage, std::size_t size,  Args...args)
     : lib_(std::move(lib)),
-      data_(make_data<Args...>(lib_, size, static_cast<Args>(args)...)),
-      is_allocating_(true),
+      data_(make_data<Args...>(lib_, storage, size, static_cast<Args>(args)...)),
+      is_allocating_(false),
       size_(size),
-      ti_(lib.get_type_info<T>())
+      ti_(lib_.get_type_info<T>())
+{
+
+}
+
+template<typename T>
+template<typename ...Args>
+imported_class_array<T>::imported_class_array(detail::sequence<Args...> *, const smart_library & lib,
+        std::size_t size, std::size_t count, Args...args)
+    : lib_(lib),
+      dtor_(lib_.get_destructor<T>()),
+      size_(size),
+      count_(0)
 {
+    constructor<T(Args...)> ctor = lib_.get_constructor<T(Args...)>();
+
+    if (!ctor.has_standard() || !dtor_.has_standard())
+    {
+        std::error_code ec = std::make_error_code(
+            std::errc::bad_file_descriptor
+        );
+
+        // report_error() calls dlsym, do not use it here!
+        boost::throw_exception(
+            boost::dll::fs::system_error(
+                ec, "boost::dll::import_class_array() failed: no regular ctor or dtor was found"
+            )
+        );
+    }
+
+    if (size && count > (std::numeric_limits<std::size_t>::max)() / size)
+        boost::throw_exception(std::bad_alloc());
 
+    data_.reset(new char[size * count]);
+
+    try {
+        for (; count_ < count; ++count_)
+            ctor.call_standard(reinterpret_cast<T*>(data_.get() + count_ * size), static_cast<Args>(args)...);
+    } catch (...) {
+        destroy();
+        throw;
+    }
 }
 
 template<typename T>
@@ -378,7 +957,7 @@ inline imported_class<T> boost::dll::experimental::imported_class<T>::copy() con
     if (this->is_allocating_)
         return imported_class<T>::template make<const T&>(lib_, *data_);
     else
-        return imported_class<T>::template make<const T&>(lib_, size_, *data_);
+        return imported_class<T>::template make<const T&>(lib_, data_.get_deleter().storage, size_, *data_);
 }
 
 template<typename T>
@@ -387,7 +966,7 @@ inline imported_class<T> boost::dll::experimental::imported_class<T>::move()
     if (this->is_allocating_)
         return imported_class<T>::template make<T&&>(lib_, *data_);
     else
-        return imported_class<T>::template make<T&&>(lib_, size_, *data_);
+        return imported_class<T>::template make<T&&>(lib_, data_.get_deleter().storage, size_, *data_);
 }
 
 template<typename T>
@@ -520,6 +1099,90 @@ import_class(smart_library & lib, const std::string & alias_name, std::size_t si
     return imported_class<T>::template make<Args...>(lib, size, static_cast<Args>(args)...);
 }
 
+/*! Constructs an instance of the class in the memory obtained from the allocator, for example from the
+ * \ref boost::dll::experimental::imported_class_pool. Memory is returned to the allocator after the destructor of the class
+ * is called. Copies and moves made by \ref imported_class::copy() and \ref imported_class::move() use the same allocator.
+ *
+ * \b Example:
+ *
+ * \code
+ * imported_class_pool pool;
+ * auto obj = import_class<class type_alias, int>(lib, std::allocator_arg, pool, 20, 42);
+ * \endcode
+ *
+ * \tparam T Class type or alias
+ * \tparam Args Constructor argument list.
+ * \tparam Allocator Allocator of bytes, i.e. with a `value_type` of size 1. It is not copied, so it must outlive the object.
+ * \param lib Shared library to load the constructor and destructor from.
+ * \param alloc Allocator of the memory for the object.
+ * \param size Size of the class.
+ *
+ * \return class object.
+ *
+ * \throw \forcedlinkfs{system_error} if symbol does not exist or if the DLL/DSO was not loaded, or
+ *      any exception thrown by the allocator.
+ */
+template<typename T, typename ... Args, typename Allocator> imported_class<T>
+import_class(const smart_library& lib, std::allocator_arg_t, Allocator& alloc, std::size_t size, Args...args)
+{
+    return imported_class<T>::template make<Args...>(lib, detail::storage_allocator(alloc), size, static_cast<Args>(args)...);
+}
+
+//! \overload boost::dll::import_class(const smart_library& lib, std::allocator_arg_t, Allocator&, std::size_t, Args...)
+template<typename T, typename ... Args, typename Allocator> imported_class<T>
+import_class(smart_library & lib, std::allocator_arg_t, Allocator& alloc, std::size_t size, Args...args)
+{
+    return imported_class<T>::template make<Args...>(lib, detail::storage_allocator(alloc), size, static_cast<Args>(args)...);
+}
+
+/*! \overload boost::dll::import_class(const smart_library& lib, std::allocator_arg_t, Allocator&, std::size_t, Args...)
+ * \note This function does add the type alias to the \ref boost::dll::experimental::smart_library.
+ */
+template<typename T, typename ... Args, typename Allocator> imported_class<T>
+import_class(smart_library & lib, const std::string & alias_name, std::allocator_arg_t, Allocator& alloc, std::size_t size, Args...args)
+{
+    lib.add_type_alias<T>(alias_name);
+    return imported_class<T>::template make<Args...>(lib, detail::storage_allocator(alloc), size, static_cast<Args>(args)...);
+}
+
+/*! Returns an \ref imported_class_array of `count` instances of the class, constructed in a contiguous memory
+ * with the same constructor arguments. Constructor and destructor are looked up only once.
+ *
+ * \b Example:
+ *
+ * \code
+ * auto arr = import_class_array<class type_alias, int>(lib, 20, 1000, 42);
+ * for (auto& obj : arr) { ... }
+ * \endcode
+ *
+ * \tparam T Class type or alias
+ * \tparam Args Constructor argument list.
+ * \param lib Shared library to load the constructor and destructor from.
+ * \param size Size of the class.
+ * \param count Count of the objects.
+ *
+ * \return array of the class objects.
+ *
+ * \throw \forcedlinkfs{system_error} if symbol does not exist or if the DLL/DSO was not loaded,
+ *      std::bad_alloc in case of insufficient memory, or any exception thrown by the constructor. In case of
+ *      exception the already constructed objects are destroyed.
+ */
+template<typename T, typename ... Args> imported_class_array<T>
+import_class_array(const smart_library& lib, std::size_t size, std::size_t count, Args...args)
+{
+    return imported_class_array<T>::template make<Args...>(lib, size, count, static_cast<Args>(args)...);
+}
+
+/*! \overload boost::dll::import_class_array(const smart_library& lib, std::size_t, std::size_t, Args...)
+ * \note This function does add the type alias to the \ref boost::dll::experimental::smart_library.
+ */
+template<typename T, typename ... Args> imported_class_array<T>
+import_class_array(smart_library & lib, const std::string & alias_name, std::size_t size, std::size_t count, Args...args)
+{
+    lib.add_type_alias<T>(alias_name);
+    return imported_class_array<T>::template make<Args...>(lib, size, count, static_cast<Args>(args)...);
+}
+
 }
 }
 }
@@ -29,8 +29,11 @@
 
 #if !defined(BOOST_DLL_INTERFACE_UNIT)
 #if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
 #include <memory>  // std::addressof
+#include <string>
 #include <type_traits>
+#include <vector>
 #endif // !defined(BOOST_DLL_USE_STD_MODULE)
 #endif // !defined(BOOST_DLL_INTERFACE_UNIT)
 
@@ -112,13 +115,25 @@ template <class ...Args>
 struct mangled_import_type<sequence<Args...>, true,false,false> //is function
 {
     typedef boost::dll::experimental::detail::mangled_library_function<Args...> type;
-    static type make(
+
+    template<std::size_t ...I>
+    static type make_impl(
            const boost::dll::experimental::smart_library& p,
-           const std::string& name)
+           const std::vector<std::string>& names,
+           index_sequence<I...> *)
     {
         return type(
                 boost::dll::detail::make_shared<shared_library>(p.shared_lib()),
-                std::addressof(p.get_function<Args>(name))...);
+                std::addressof(p.shared_lib().template get<Args>(names[I]))...);
+    }
+
+    static type make(
+           const boost::dll::experimental::smart_library& p,
+           const std::string& name)
+    {
+        // All the overloads are found in a single pass over the symbols
+        typedef typename make_index_sequence<sizeof...(Args)>::type indexes;
+        return make_impl(p, p.symbol_storage().template get_functions<Args...>(name), static_cast<indexes*>(nullptr));
     }
 };
 
@@ -129,14 +144,27 @@ struct mangled_import_type<sequence<Class, Args...>, false, true, false> //is me
     typedef typename boost::dll::experimental::detail::mangled_library_mem_fn<Class, actual_sequence> type;
 
 
-    template<class ... ArgsIn>
+    template<class ... ArgsIn, std::size_t ...I>
     static type make_impl(
             const boost::dll::experimental::smart_library& p,
             const std::string & name,
-            sequence<ArgsIn...> * )
+            sequence<ArgsIn...> *,
+            index_sequence<I...> *)
     {
+        // All the overloads are found in a single pass over the symbols
+        const std::vector<std::string> names = p.symbol_storage().template get_mem_fns<ArgsIn...>(name);
         return type(boost::dll::detail::make_shared<shared_library>(p.shared_lib()),
-                    p.get_mem_fn<typename ArgsIn::class_type, typename ArgsIn::func_type>(name)...);
+                    p.shared_lib().template get<typename ArgsIn::mem_fn>(names[I])...);
+    }
+
+    template<class ... ArgsIn>
+    static type make_impl(
+            const boost::dll::experimental::smart_library& p,
+            const std::string & name,
+            sequence<ArgsIn...> * seq)
+    {
+        typedef typename make_index_sequence<sizeof...(ArgsIn)>::type indexes;
+        return make_impl(p, name, seq, static_cast<indexes*>(nullptr));
     }
 
     static type make(
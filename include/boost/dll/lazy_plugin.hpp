@@ -0,0 +1,280 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/lazy_plugin.hpp
+/// \brief Contains the boost::dll::lazy_plugin class that loads the plugin on first use.
+
+#ifndef BOOST_DLL_LAZY_PLUGIN_HPP
+#define BOOST_DLL_LAZY_PLUGIN_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/import.hpp>
+#include <boost/dll/library_info.hpp>
+#include <boost/dll/shared_library.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+template <class T>
+class lazy_alias;
+
+/*!
+* \brief Handle to a plugin that is loaded on first use.
+*
+* Path, exported aliases and the build identity of the plugin are read from the file by
+* boost::dll::library_info at construction, without loading the plugin. The plugin is loaded only when its
+* symbols are requested for the first time, so static constructors of the unused plugins are never run
+* and their code is not mapped.
+*
+* Copies of the handle share the same plugin, that is loaded at most once for all the copies. All the member
+* functions are thread safe. If loading fails, the error is reported to the caller and the next use
+* tries to load the plugin again.
+*/
+class lazy_plugin {
+    /// @cond
+    struct state {
+        boost::dll::fs::path                                path;
+        load_mode::type                                     mode;
+        std::vector<std::string>                            aliases;
+        boost::dll::binary_id                               build_id;
+
+        std::mutex                                          mutex;
+        std::atomic<bool>                                   loaded{false};
+        boost::dll::detail::shared_ptr<shared_library>      library;
+    };
+
+    boost::dll::detail::shared_ptr<state> state_;
+
+    const boost::dll::detail::shared_ptr<shared_library>& load() const {
+        if (!state_->loaded.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            if (!state_->library) {
+                state_->library = boost::dll::detail::make_shared<shared_library>(state_->path, state_->mode);
+                state_->loaded.store(true, std::memory_order_release);
+            }
+        }
+
+        return state_->library;
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Reads the exported aliases and the build identity of the plugin without loading it.
+    *
+    * \param plugin_path Path to the plugin.
+    * \param mode A mode that will be used on plugin load.
+    * \param section_name Name of the section with the aliases, "boostdll" for the \forcedmacrolink{BOOST_DLL_ALIAS}.
+    * \throws std::exception based exceptions if the file is not a native binary, std::bad_alloc in case
+    * of insufficient memory.
+    */
+    explicit lazy_plugin(const boost::dll::fs::path& plugin_path, load_mode::type mode = load_mode::default_mode,
+        const char* section_name = "boostdll")
+        : state_(boost::dll::detail::make_shared<state>())
+    {
+        boost::dll::library_info info(plugin_path);
+        state_->path = plugin_path;
+        state_->mode = mode;
+        state_->aliases = info.symbols(section_name);
+        state_->build_id = info.build_id();
+
+        std::sort(state_->aliases.begin(), state_->aliases.end());
+    }
+
+    /*!
+    * \return Path to the plugin.
+    * \throws Nothing.
+    */
+    const boost::dll::fs::path& location() const noexcept {
+        return state_->path;
+    }
+
+    /*!
+    * \return Sorted list of the aliases that the plugin exports. Plugin is not loaded.
+    * \throws Nothing.
+    */
+    const std::vector<std::string>& aliases() const noexcept {
+        return state_->aliases;
+    }
+
+    /*!
+    * \return Build identity of the plugin that was read at construction, see boost::dll::library_info::build_id().
+    * \throws Nothing.
+    */
+    const boost::dll::binary_id& build_id() const noexcept {
+        return state_->build_id;
+    }
+
+    /*!
+    * \param alias_name Name of the alias.
+    * \return true if the plugin exports the alias. Plugin is not loaded.
+    * \throws Nothing.
+    */
+    bool has_alias(const char* alias_name) const noexcept {
+        return std::binary_search(state_->aliases.begin(), state_->aliases.end(), alias_name);
+    }
+
+    //! \overload bool has_alias(const char* alias_name) const noexcept
+    bool has_alias(const std::string& alias_name) const noexcept {
+        return std::binary_search(state_->aliases.begin(), state_->aliases.end(), alias_name);
+    }
+
+    /*!
+    * \return true if the plugin was already loaded.
+    * \throws Nothing.
+    */
+    bool is_loaded() const noexcept {
+        return state_->loaded.load(std::memory_order_acquire);
+    }
+
+    /*!
+    * Loads the plugin if it was not loaded yet.
+    *
+    * \return Loaded plugin.
+    * \throws \forcedlinkfs{system_error} if the plugin could not be loaded, std::bad_alloc in case of
+    * insufficient memory.
+    */
+    const shared_library& library() const {
+        return *load();
+    }
+
+    /*!
+    * Loads the plugin if it was not loaded yet and imports the alias as boost::dll::import_alias does.
+    *
+    * \b Template \b parameter \b T: Type of the symbol alias that we are going to import. Must be explicitly specified.
+    *
+    * \param alias_name Name of the alias.
+    * \return Callable object or shared pointer that keeps the plugin loaded.
+    * \throws \forcedlinkfs{system_error} if the plugin could not be loaded or the alias does not exist,
+    * std::bad_alloc in case of insufficient memory.
+    */
+    template <class T>
+    boost::dll::detail::import_type<T> get_alias(const char* alias_name) const {
+        const boost::dll::detail::shared_ptr<shared_library>& lib = load();
+        return boost::dll::detail::import_type<T>(lib, lib->get<T*>(alias_name));
+    }
+
+    //! \overload boost::dll::detail::import_type<T> get_alias(const char* alias_name) const
+    template <class T>
+    boost::dll::detail::import_type<T> get_alias(const std::string& alias_name) const {
+        return get_alias<T>(alias_name.c_str());
+    }
+
+    /*!
+    * Creates a callable that loads the plugin and resolves the function alias on its first call.
+    *
+    * \b Template \b parameter \b T: Function type of the alias. Must be explicitly specified.
+    *
+    * \param alias_name Name of the alias.
+    * \return boost::dll::lazy_alias that shares the plugin with this handle.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    template <class T>
+    boost::dll::lazy_alias<T> alias(std::string alias_name) const {
+        return boost::dll::lazy_alias<T>(*this, std::move(alias_name));
+    }
+};
+
+/*!
+* \brief Callable that loads the boost::dll::lazy_plugin and resolves the function alias on its first call,
+* see boost::dll::lazy_plugin::alias().
+*
+* Resolved function is cached, so the following calls cost an atomic load and an indirect call. Copies of
+* the boost::dll::lazy_alias made after the first call do not resolve the alias again.
+*
+* \b Template \b parameter \b T: Function type of the alias.
+*/
+template <class T>
+class lazy_alias {
+    static_assert(std::is_function<T>::value, "boost::dll::lazy_alias<T> requires a function type");
+
+    boost::dll::lazy_plugin     plugin_;
+    std::string                 name_;
+    mutable std::atomic<T*>     function_;
+
+    /// @cond
+    T* resolve() const {
+        T* f = function_.load(std::memory_order_acquire);
+        if (!f) {
+            // Concurrent resolutions return the same address, so no additional synchronization is required
+            f = plugin_.library().template get<T*>(name_.c_str());
+            function_.store(f, std::memory_order_release);
+        }
+        return f;
+    }
+    /// @endcond
+
+public:
+    /// @cond
+    lazy_alias(boost::dll::lazy_plugin plugin, std::string name) noexcept
+        : plugin_(std::move(plugin))
+        , name_(std::move(name))
+        , function_(nullptr)
+    {}
+    /// @endcond
+
+    /*!
+    * Copy constructor.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    lazy_alias(const lazy_alias& other)
+        : plugin_(other.plugin_)
+        , name_(other.name_)
+        , function_(other.function_.load(std::memory_order_acquire))
+    {}
+
+    lazy_alias& operator=(const lazy_alias&) = delete;
+
+    /*!
+    * \return Plugin of the alias.
+    * \throws Nothing.
+    */
+    const boost::dll::lazy_plugin& plugin() const noexcept {
+        return plugin_;
+    }
+
+    /*!
+    * Loads the plugin and resolves the alias if it was not done yet, then calls the function.
+    *
+    * \throws \forcedlinkfs{system_error} if the plugin could not be loaded or the alias does not exist,
+    * std::bad_alloc in case of insufficient memory, or any exception thrown by the function.
+    */
+    template <class... Args>
+    auto operator()(Args&&... args) const
+        -> decltype( (*static_cast<T*>(nullptr))(static_cast<Args&&>(args)...) )
+    {
+        return (*resolve())(static_cast<Args&&>(args)...);
+    }
+};
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#endif // BOOST_DLL_LAZY_PLUGIN_HPP
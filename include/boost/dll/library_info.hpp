@@ -30,19 +30,141 @@
 #include <boost/throw_exception.hpp>
 
 #if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstdint>
+#include <ctime>
 #include <fstream>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #endif // !defined(BOOST_DLL_USE_STD_MODULE)
 #endif // !defined(BOOST_DLL_INTERFACE_UNIT)
 
 #include <boost/dll/detail/pe_info.hpp>
 #include <boost/dll/detail/elf_info.hpp>
 #include <boost/dll/detail/macho_info.hpp>
+#include <boost/dll/symbol_info.hpp>
 
 BOOST_DLL_BEGIN_MODULE_EXPORT
 
 namespace boost { namespace dll {
 
+/*!
+* \brief Read only view to the content of a section of a binary file, see boost::dll::library_info::section_data().
+*
+* The content is read from the file by a single bulk read. Copies of the view share the same content
+* without copying it.
+*/
+class section_view {
+    boost::dll::detail::shared_ptr<const std::vector<char> > data_;
+    std::uint64_t file_offset_ = 0;
+
+public:
+    /*!
+    * Creates an empty view.
+    * \throws Nothing.
+    */
+    section_view() = default;
+
+    /// @cond
+    section_view(boost::dll::detail::shared_ptr<const std::vector<char> > data, std::uint64_t file_offset) noexcept
+        : data_(std::move(data))
+        , file_offset_(file_offset)
+    {}
+    /// @endcond
+
+    /*!
+    * \return Pointer to the beginning of the section content or nullptr if the view is empty.
+    * \throws Nothing.
+    */
+    const char* data() const noexcept {
+        return (data_ && !data_->empty() ? &(*data_)[0] : nullptr);
+    }
+
+    /*!
+    * \return Size of the section content in bytes.
+    * \throws Nothing.
+    */
+    std::size_t size() const noexcept {
+        return (data_ ? data_->size() : 0);
+    }
+
+    /*!
+    * \return true if the section has no content in file or does not exist.
+    * \throws Nothing.
+    */
+    bool empty() const noexcept {
+        return !size();
+    }
+
+    /*!
+    * \return Offset of the section content from the beginning of the file.
+    * \throws Nothing.
+    */
+    std::uint64_t file_offset() const noexcept {
+        return file_offset_;
+    }
+
+    /*!
+    * \return Pointer to the beginning of the section content.
+    * \throws Nothing.
+    */
+    const char* begin() const noexcept {
+        return data();
+    }
+
+    /*!
+    * \return Pointer to the end of the section content.
+    * \throws Nothing.
+    */
+    const char* end() const noexcept {
+        return data() + size();
+    }
+};
+
+/*!
+* \brief Identity of a binary file, see boost::dll::library_info::build_id().
+*/
+struct binary_id {
+    /// Source of the identity.
+    enum class source_type {
+        gnu_build_id,   ///< ELF NT_GNU_BUILD_ID note
+        macho_uuid,     ///< Mach-O LC_UUID load command
+        pe_codeview,    ///< PE CodeView debug record GUID and age
+        fingerprint     ///< Binary has no build identity, a fingerprint of the file is used
+    };
+
+    /// Source of the identity.
+    source_type source = source_type::fingerprint;
+
+    /// Raw bytes of the identity.
+    std::vector<unsigned char> bytes;
+
+    /// \return Lowercase hexadecimal representation of the bytes.
+    std::string to_string() const {
+        static const char digits[] = "0123456789abcdef";
+
+        std::string ret;
+        ret.reserve(bytes.size() * 2);
+        for (std::size_t i = 0; i < bytes.size(); ++i) {
+            ret += digits[bytes[i] >> 4];
+            ret += digits[bytes[i] & 0x0f];
+        }
+
+        return ret;
+    }
+
+    /// \return true if both identities have the same source and bytes.
+    friend bool operator==(const binary_id& lhs, const binary_id& rhs) noexcept {
+        return lhs.source == rhs.source && lhs.bytes == rhs.bytes;
+    }
+
+    /// \return true if identities differ.
+    friend bool operator!=(const binary_id& lhs, const binary_id& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+};
+
 /*!
 * \brief Class that is capable of extracting different information from a library or binary file.
 * Currently understands ELF, MACH-O and PE formats on all the platforms.
@@ -50,6 +172,7 @@ namespace boost { namespace dll {
 class library_info: private boost::noncopyable {
 private:
     std::ifstream f_;
+    boost::dll::fs::path path_;
 
     enum {
         fmt_elf_info32,
@@ -119,9 +242,103 @@ private:
             boost::throw_exception(std::runtime_error("Unsupported binary format"));
         }
     }
+    template <class FileTime>
+    static std::uint64_t file_time_to_integer(const FileTime& t) noexcept {
+        return static_cast<std::uint64_t>(t.time_since_epoch().count());
+    }
+
+    static std::uint64_t file_time_to_integer(std::time_t t) noexcept {
+        return static_cast<std::uint64_t>(t);
+    }
+
+    // FNV-1a
+    static void hash_combine(std::uint64_t& hash, const void* data, std::size_t size) noexcept {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ull;
+        }
+    }
+
+    boost::dll::binary_id fingerprint() {
+        static const std::size_t headers_size = 4096;
+
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+
+        f_.seekg(0, std::ios_base::end);
+        const std::uint64_t file_size = static_cast<std::uint64_t>(f_.tellg());
+        hash_combine(hash, &file_size, sizeof(file_size));
+
+        boost::dll::fs::error_code ec;
+        const std::uint64_t mtime = file_time_to_integer(boost::dll::fs::last_write_time(path_, ec));
+        if (!ec) {
+            hash_combine(hash, &mtime, sizeof(mtime));
+        }
+
+        // File header with the program headers, PE section table or load commands at the beginning of the
+        // file, and the ELF section header table that is usually at the end.
+        char headers[headers_size];
+        const std::size_t to_read = static_cast<std::size_t>(file_size < headers_size ? file_size : headers_size);
+        f_.seekg(0);
+        f_.read(headers, static_cast<std::streamsize>(to_read));
+        hash_combine(hash, headers, to_read);
+
+        if (file_size > headers_size) {
+            f_.seekg(static_cast<std::streamoff>(file_size - to_read));
+            f_.read(headers, static_cast<std::streamsize>(to_read));
+            hash_combine(hash, headers, to_read);
+        }
+
+        // Raw bytes of the dynamic symbol table, so that the changed exports change the fingerprint
+        std::vector<std::pair<std::uint64_t, std::uint64_t> > ranges;
+        switch (fmt_) {
+        case fmt_elf_info32:   boost::dll::detail::elf_info32::symbol_table_location(f_, ranges); break;
+        case fmt_elf_info64:   boost::dll::detail::elf_info64::symbol_table_location(f_, ranges); break;
+        case fmt_pe_info32:    boost::dll::detail::pe_info32::symbol_table_location(f_, ranges); break;
+        case fmt_pe_info64:    boost::dll::detail::pe_info64::symbol_table_location(f_, ranges); break;
+        case fmt_macho_info32: boost::dll::detail::macho_info32::symbol_table_location(f_, ranges); break;
+        case fmt_macho_info64: boost::dll::detail::macho_info64::symbol_table_location(f_, ranges); break;
+        };
+
+        for (std::size_t i = 0; i < ranges.size(); ++i) {
+            std::uint64_t offset = ranges[i].first;
+            if (offset > file_size) {
+                continue;
+            }
+
+            std::uint64_t size = (file_size - offset < ranges[i].second ? file_size - offset : ranges[i].second);
+            f_.seekg(static_cast<std::streamoff>(offset));
+            while (size) {
+                const std::size_t chunk = static_cast<std::size_t>(size < headers_size ? size : headers_size);
+                f_.read(headers, static_cast<std::streamsize>(chunk));
+                hash_combine(hash, headers, chunk);
+                size -= chunk;
+            }
+        }
+
+        boost::dll::binary_id ret;
+        ret.source = boost::dll::binary_id::source_type::fingerprint;
+        ret.bytes.resize(sizeof(hash));
+        for (std::size_t i = 0; i < sizeof(hash); ++i) {
+            ret.bytes[i] = static_cast<unsigned char>(hash >> (8 * (sizeof(hash) - 1 - i)));
+        }
+        return ret;
+    }
     /// @endcond
 
 public:
+    /*!
+    * \brief Formats of the binary files that could be parsed by library_info.
+    */
+    enum class binary_format {
+        elf32,      ///< 32 bit ELF file
+        elf64,      ///< 64 bit ELF file
+        pe32,       ///< 32 bit PE file
+        pe64,       ///< 64 bit PE file
+        macho32,    ///< 32 bit Mach-O file
+        macho64     ///< 64 bit Mach-O file
+    };
+
     /*!
     * Opens file with specified path and prepares for information extraction.
     * \param library_path Path to the binary file from which the info must be extracted.
@@ -142,6 +359,7 @@ public:
         #endif
             std::ios_base::in | std::ios_base::binary
         )
+        , path_(library_path)
     {
         f_.exceptions(
             std::ios_base::failbit
@@ -152,6 +370,104 @@ public:
         init(throw_if_not_native_format);
     }
 
+    /*!
+    * \param section_name Name of the section which content must be returned.
+    * \return View to the content of the section. The view is empty if the section does not exist or
+    * occupies no space in the file (for example ".bss").
+    * \throws std::exception based exceptions.
+    */
+    boost::dll::section_view section_data(const char* section_name) {
+        bool found = false;
+        std::uint64_t offset = 0;
+        std::uint64_t size = 0;
+        switch (fmt_) {
+        case fmt_elf_info32:   found = boost::dll::detail::elf_info32::section_location(f_, section_name, offset, size); break;
+        case fmt_elf_info64:   found = boost::dll::detail::elf_info64::section_location(f_, section_name, offset, size); break;
+        case fmt_pe_info32:    found = boost::dll::detail::pe_info32::section_location(f_, section_name, offset, size); break;
+        case fmt_pe_info64:    found = boost::dll::detail::pe_info64::section_location(f_, section_name, offset, size); break;
+        case fmt_macho_info32: found = boost::dll::detail::macho_info32::section_location(f_, section_name, offset, size); break;
+        case fmt_macho_info64: found = boost::dll::detail::macho_info64::section_location(f_, section_name, offset, size); break;
+        };
+
+        if (!found || !size) {
+            return boost::dll::section_view(nullptr, offset);
+        }
+
+        f_.seekg(0, std::ios_base::end);
+        const std::uint64_t file_size = static_cast<std::uint64_t>(f_.tellg());
+        if (offset > file_size || file_size - offset < size) {
+            boost::throw_exception(std::runtime_error("Section content is out of the file bounds"));
+        }
+
+        boost::dll::detail::shared_ptr<std::vector<char> > data = boost::dll::detail::make_shared<std::vector<char> >(
+            static_cast<std::size_t>(size)
+        );
+        f_.seekg(static_cast<std::streamoff>(offset));
+        f_.read(&(*data)[0], static_cast<std::streamsize>(size));
+
+        return boost::dll::section_view(std::move(data), offset);
+    }
+
+    //! \overload boost::dll::section_view section_data(const char* section_name)
+    boost::dll::section_view section_data(const std::string& section_name) {
+        return section_data(section_name.c_str());
+    }
+
+    /*!
+    * Returns the identity of the build that produced the binary: the NT_GNU_BUILD_ID note for ELF, LC_UUID for
+    * Mach-O and the CodeView GUID and age for PE. Only the note, load command or debug directory is read.
+    *
+    * If the binary has no such identity, a fingerprint is computed from the file size, modification time, first
+    * 4 KiB and last 4 KiB of the file and the raw bytes of the dynamic symbol table: ".dynsym" and ".dynstr" for
+    * ELF, the export directory for PE and the LC_SYMTAB tables for Mach-O. The first 4 KiB hold the file headers.
+    * The last 4 KiB hold the section header table for ELF, and the last section data or the link edit data
+    * for PE and Mach-O. Symbol names are not parsed. The fingerprint changes on relinking even if the content
+    * is the same.
+    *
+    * \return Identity of the binary, suitable for cheap change detection.
+    * \throws std::exception based exceptions.
+    */
+    boost::dll::binary_id build_id() {
+        boost::dll::binary_id ret;
+        bool found = false;
+        switch (fmt_) {
+        case fmt_elf_info32:   found = boost::dll::detail::elf_info32::build_id(f_, ret.bytes); break;
+        case fmt_elf_info64:   found = boost::dll::detail::elf_info64::build_id(f_, ret.bytes); break;
+        case fmt_pe_info32:    found = boost::dll::detail::pe_info32::build_id(f_, ret.bytes); break;
+        case fmt_pe_info64:    found = boost::dll::detail::pe_info64::build_id(f_, ret.bytes); break;
+        case fmt_macho_info32: found = boost::dll::detail::macho_info32::build_id(f_, ret.bytes); break;
+        case fmt_macho_info64: found = boost::dll::detail::macho_info64::build_id(f_, ret.bytes); break;
+        };
+
+        if (!found) {
+            return fingerprint();
+        }
+
+        switch (fmt_) {
+        case fmt_elf_info32: case fmt_elf_info64:       ret.source = boost::dll::binary_id::source_type::gnu_build_id; break;
+        case fmt_pe_info32: case fmt_pe_info64:         ret.source = boost::dll::binary_id::source_type::pe_codeview; break;
+        case fmt_macho_info32: case fmt_macho_info64:   ret.source = boost::dll::binary_id::source_type::macho_uuid; break;
+        };
+        return ret;
+    }
+
+    /*!
+    * \return Format of the binary file.
+    * \throws Nothing.
+    */
+    binary_format format() const noexcept {
+        switch (fmt_) {
+        case fmt_elf_info32:   return binary_format::elf32;
+        case fmt_elf_info64:   return binary_format::elf64;
+        case fmt_pe_info32:    return binary_format::pe32;
+        case fmt_pe_info64:    return binary_format::pe64;
+        case fmt_macho_info32: return binary_format::macho32;
+        case fmt_macho_info64: return binary_format::macho64;
+        };
+        BOOST_ASSERT(false);
+        BOOST_UNREACHABLE_RETURN(binary_format::elf64)
+    }
+
     /*!
     * \return List of sections that exist in binary file.
     * \throws std::exception based exceptions.
@@ -169,6 +485,22 @@ public:
         BOOST_UNREACHABLE_RETURN(std::vector<std::string>())
     }
 
+    /*!
+    * Same as sections(), but stores the list into `out`, reusing its capacity.
+    * \param out Container to store the list of sections.
+    * \throws std::exception based exceptions.
+    */
+    void sections(std::vector<std::string>& out) {
+        switch (fmt_) {
+        case fmt_elf_info32:   boost::dll::detail::elf_info32::sections(f_, out); break;
+        case fmt_elf_info64:   boost::dll::detail::elf_info64::sections(f_, out); break;
+        case fmt_pe_info32:    boost::dll::detail::pe_info32::sections(f_, out); break;
+        case fmt_pe_info64:    boost::dll::detail::pe_info64::sections(f_, out); break;
+        case fmt_macho_info32: boost::dll::detail::macho_info32::sections(f_, out); break;
+        case fmt_macho_info64: boost::dll::detail::macho_info64::sections(f_, out); break;
+        };
+    }
+
     /*!
     * \return List of all the exportable symbols from all the sections that exist in binary file.
     * \throws std::exception based exceptions.
@@ -186,6 +518,67 @@ public:
         BOOST_UNREACHABLE_RETURN(std::vector<std::string>())
     }
 
+    /*!
+    * Same as symbols(), but stores the list into `out`, reusing its capacity.
+    * \param out Container to store the list of symbols.
+    * \throws std::exception based exceptions.
+    */
+    void symbols(std::vector<std::string>& out) {
+        switch (fmt_) {
+        case fmt_elf_info32:   boost::dll::detail::elf_info32::symbols(f_, out); break;
+        case fmt_elf_info64:   boost::dll::detail::elf_info64::symbols(f_, out); break;
+        case fmt_pe_info32:    boost::dll::detail::pe_info32::symbols(f_, out); break;
+        case fmt_pe_info64:    boost::dll::detail::pe_info64::symbols(f_, out); break;
+        case fmt_macho_info32: boost::dll::detail::macho_info32::symbols(f_, out); break;
+        case fmt_macho_info64: boost::dll::detail::macho_info64::symbols(f_, out); break;
+        };
+    }
+
+    /*!
+    * Checks that the symbol is in the list returned by symbols(). Stops on the first match and does not
+    * build the list.
+    * \param symbol_name Name of the symbol to look for.
+    * \return `true` if the binary has the symbol.
+    * \throws std::exception based exceptions.
+    */
+    bool has_symbol(const char* symbol_name) {
+        switch (fmt_) {
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::has_symbol(f_, symbol_name);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::has_symbol(f_, symbol_name);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::has_symbol(f_, symbol_name);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::has_symbol(f_, symbol_name);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::has_symbol(f_, symbol_name);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::has_symbol(f_, symbol_name);
+        };
+        BOOST_ASSERT(false);
+        BOOST_UNREACHABLE_RETURN(false)
+    }
+
+    //! \overload bool has_symbol(const char* symbol_name)
+    bool has_symbol(const std::string& symbol_name) {
+        return has_symbol(symbol_name.c_str());
+    }
+
+    /*!
+    * Returns information about the same symbols as symbols() does and in the same order. Symbol names
+    * are returned without the GNU version suffixes, versions are available via boost::dll::symbol_info::version.
+    *
+    * \return List of boost::dll::symbol_info for all the exportable symbols from all the sections that exist in binary file.
+    * \throws std::exception based exceptions.
+    */
+    std::vector<boost::dll::symbol_info> symbols_info() {
+        switch (fmt_) {
+        case fmt_elf_info32:   return boost::dll::detail::elf_info32::symbols_info(f_);
+        case fmt_elf_info64:   return boost::dll::detail::elf_info64::symbols_info(f_);
+        case fmt_pe_info32:    return boost::dll::detail::pe_info32::symbols_info(f_);
+        case fmt_pe_info64:    return boost::dll::detail::pe_info64::symbols_info(f_);
+        case fmt_macho_info32: return boost::dll::detail::macho_info32::symbols_info(f_);
+        case fmt_macho_info64: return boost::dll::detail::macho_info64::symbols_info(f_);
+        };
+        BOOST_ASSERT(false);
+        BOOST_UNREACHABLE_RETURN(std::vector<boost::dll::symbol_info>())
+    }
+
     /*!
     * \param section_name Name of the section from which symbol names must be returned.
     * \return List of symbols from the specified section.
@@ -0,0 +1,188 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/library_scanner.hpp
+/// \brief Contains boost::dll::scan_libraries functions that extract information from
+/// many binaries at once using multiple threads.
+
+#ifndef BOOST_DLL_LIBRARY_SCANNER_HPP
+#define BOOST_DLL_LIBRARY_SCANNER_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/library_info.hpp>
+#include <boost/dll/detail/worker_pool.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Information extracted from a single binary by boost::dll::scan_libraries.
+*/
+struct scanned_library {
+    /// Path to the binary.
+    boost::dll::fs::path path;
+
+    /// Format of the binary. Meaningful only if `error` is empty.
+    boost::dll::library_info::binary_format format;
+
+    /// List of sections that exist in binary, see boost::dll::library_info::sections().
+    std::vector<std::string> sections;
+
+    /// List of all the exportable symbols, see boost::dll::library_info::symbols().
+    std::vector<std::string> symbols;
+
+    /// Exception that was thrown during the binary processing or empty exception pointer on success.
+    std::exception_ptr error;
+};
+
+/// @cond
+namespace detail {
+
+template <class Callback>
+class library_scanner {
+    const std::vector<boost::dll::fs::path>&    paths_;
+    Callback&                                   callback_;
+    std::vector<boost::dll::scanned_library>    records_;   // one per worker
+    boost::dll::detail::worker_pool             pool_;
+    std::mutex                                  callback_mutex_;
+    std::exception_ptr                          callback_error_;
+
+    static void scan(boost::dll::scanned_library& record) {
+        boost::dll::library_info info(record.path, false);
+        record.format = info.format();
+        info.sections(record.sections);
+        info.symbols(record.symbols);
+    }
+
+public:
+    library_scanner(const std::vector<boost::dll::fs::path>& paths, Callback& callback, std::size_t workers)
+        : paths_(paths)
+        , callback_(callback)
+        , records_(workers)
+        , pool_(paths.size())
+    {}
+
+    void operator()(std::size_t worker_index, std::size_t job_index) noexcept {
+        boost::dll::scanned_library& record = records_[worker_index];
+        record.sections.clear();
+        record.symbols.clear();
+        record.error = std::exception_ptr();
+
+        try {
+            record.path = paths_[job_index];
+            scan(record);
+        } catch (...) {
+            record.error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(callback_mutex_);
+        if (callback_error_) {
+            return;
+        }
+
+        try {
+            callback_(static_cast<const boost::dll::scanned_library&>(record));
+        } catch (...) {
+            callback_error_ = std::current_exception();
+            pool_.stop();
+        }
+    }
+
+    void run() {
+        pool_.run(records_.size(), *this);
+        if (callback_error_) {
+            std::rethrow_exception(callback_error_);
+        }
+    }
+};
+
+} // namespace detail
+/// @endcond
+
+/*!
+* Extracts the format, sections and exportable symbols from each of the binaries using a pool of threads.
+*
+* Results are streamed to the `callback` as soon as each binary is processed, so the callback is called in
+* an unspecified order from different threads. Calls to the `callback` are serialized, so it needs no
+* additional synchronization. The boost::dll::scanned_library passed to the `callback` is reused by
+* the worker thread for the next binary, copy or move out the data that is required after the `callback` returns.
+*
+* Errors in processing a binary do not stop the scanning, they are reported via boost::dll::scanned_library::error.
+*
+* \param paths Paths to the binaries that must be scanned.
+* \param callback Function object that is called as `callback(const boost::dll::scanned_library&)` for each path.
+* \param threads Maximal count of threads to use, including the calling thread. 0 means
+* `std::thread::hardware_concurrency()`.
+* \throws std::bad_alloc or any exception thrown by the `callback`. Exception from the `callback`
+* stops the scanning of the not yet processed binaries and is rethrown after the already running workers finish.
+*/
+template <class Callback>
+void scan_libraries(const std::vector<boost::dll::fs::path>& paths, Callback&& callback, std::size_t threads = 0) {
+    if (paths.empty()) {
+        return;
+    }
+
+    boost::dll::detail::library_scanner<typename std::remove_reference<Callback>::type> scanner(
+        paths, callback, boost::dll::detail::workers_count(threads, paths.size())
+    );
+    scanner.run();
+}
+
+/*!
+* Recursively collects all the regular files from the `directory` and scans them as
+* boost::dll::scan_libraries(const std::vector<boost::dll::fs::path>&, Callback&&, std::size_t) does.
+*
+* Files that are not binaries are reported to the `callback` with a non empty
+* boost::dll::scanned_library::error.
+*
+* \param directory Directory to scan.
+* \param callback Function object that is called as `callback(const boost::dll::scanned_library&)` for each file.
+* \param threads Maximal count of threads to use, including the calling thread. 0 means
+* `std::thread::hardware_concurrency()`.
+* \throws \forcedlinkfs{system_error} if the directory could not be traversed, std::bad_alloc or
+* any exception thrown by the `callback`.
+*/
+template <class Callback>
+void scan_libraries(const boost::dll::fs::path& directory, Callback&& callback, std::size_t threads = 0) {
+    std::vector<boost::dll::fs::path> paths;
+
+    boost::dll::fs::recursive_directory_iterator endit;
+    for (boost::dll::fs::recursive_directory_iterator it(directory); it != endit; ++it) {
+        if (boost::dll::fs::is_regular_file(*it)) {
+            paths.push_back(it->path());
+        }
+    }
+
+    boost::dll::scan_libraries(paths, callback, threads);
+}
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#endif // BOOST_DLL_LIBRARY_SCANNER_HPP
@@ -0,0 +1,185 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/loaded_library_info.hpp
+/// \brief Contains the boost::dll::loaded_library_info class that extracts sections and exported symbols
+/// from the memory image of an already loaded library.
+
+#ifndef BOOST_DLL_LOADED_LIBRARY_INFO_HPP
+#define BOOST_DLL_LOADED_LIBRARY_INFO_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/shared_library.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/predef/os.h>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+#if BOOST_OS_WINDOWS
+#   include <boost/dll/detail/windows/loaded_image_impl.hpp>
+#else
+#   include <boost/dll/detail/posix/loaded_image_impl.hpp>
+#endif
+
+#include <boost/dll/detail/system_error.hpp>
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Content of a section of a loaded library, see boost::dll::loaded_library_info::section().
+*
+* Points directly into the memory of the loaded library and is valid while the library is loaded.
+*/
+struct loaded_section {
+    /// Pointer to the beginning of the section in memory or nullptr if the section was not found.
+    const char* data = nullptr;
+
+    /// Size of the section in bytes.
+    std::size_t size = 0;
+
+    /// \return Pointer to the beginning of the section.
+    const char* begin() const noexcept { return data; }
+
+    /// \return Pointer past the end of the section.
+    const char* end() const noexcept { return data + size; }
+
+    /// \return true if the section was not found or has no content.
+    bool empty() const noexcept { return !size; }
+};
+
+/*!
+* \brief Extracts sections and exported symbols of an already loaded library directly from its memory image.
+*
+* Unlike boost::dll::library_info it does not open and parse the file of the library: exported symbols are taken
+* from the in-memory dynamic symbol table (ELF), `__LINKEDIT` segment (Mach-O) or the export directory (PE), and
+* section contents are returned as pointers into the loaded image. For ELF binaries the section headers are
+* not mapped into memory, so only the section header table is read from the file, once, when section names are
+* first required.
+*
+* On platforms without usable in-memory information the data is read from the file of the library and
+* section() always returns an empty section.
+*
+* The library must remain loaded while the boost::dll::loaded_library_info and the returned sections are in use.
+*/
+class loaded_library_info {
+    boost::dll::detail::loaded_image_impl impl_;
+
+    /// @cond
+    void init(const boost::dll::shared_library& lib, std::error_code& ec) {
+        if (!lib.is_loaded()) {
+            ec = std::make_error_code(std::errc::bad_file_descriptor);
+            return;
+        }
+
+        impl_.init(lib.native(), ec);
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Creates the information object for the loaded library.
+    *
+    * \param lib Loaded library.
+    * \throws \forcedlinkfs{system_error} if the library is not loaded or its image could not be found, std::bad_alloc
+    * in case of insufficient memory.
+    */
+    explicit loaded_library_info(const boost::dll::shared_library& lib) {
+        std::error_code ec;
+        init(lib, ec);
+        if (ec) {
+            boost::throw_exception(boost::dll::fs::system_error(ec, "boost::dll::loaded_library_info() failed"));
+        }
+    }
+
+    /*!
+    * Creates the information object for the loaded library.
+    *
+    * \param lib Loaded library.
+    * \param ec Variable that will be set to the result of the operation.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    loaded_library_info(const boost::dll::shared_library& lib, std::error_code& ec) {
+        ec.clear();
+        init(lib, ec);
+    }
+
+    /*!
+    * \return List of sections of the loaded library.
+    * \throws std::exception or its derivative if the section names could not be read, std::bad_alloc
+    * in case of insufficient memory.
+    */
+    std::vector<std::string> sections() const {
+        return impl_.sections();
+    }
+
+    /*!
+    * \param section_name Name of the section to return.
+    * \return Content of the section in the memory of the loaded library or an empty section if the section
+    * was not found or is not loaded into memory.
+    * \throws std::exception or its derivative if the section names could not be read, std::bad_alloc
+    * in case of insufficient memory.
+    */
+    boost::dll::loaded_section section(const char* section_name) const {
+        boost::dll::loaded_section ret;
+        if (!impl_.section(section_name, ret.data, ret.size)) {
+            ret = boost::dll::loaded_section();
+        }
+        return ret;
+    }
+
+    //! \overload boost::dll::loaded_section section(const char* section_name) const
+    boost::dll::loaded_section section(const std::string& section_name) const {
+        return section(section_name.c_str());
+    }
+
+    /*!
+    * \return List of all the exported symbols of the loaded library.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    std::vector<std::string> symbols() const {
+        return impl_.symbols();
+    }
+
+    /*!
+    * \param section_name Name of the section from which symbols will be taken. For example "boostdll".
+    * \return List of the exported symbols from the specified section.
+    * \throws std::exception or its derivative if the section names could not be read, std::bad_alloc
+    * in case of insufficient memory.
+    */
+    std::vector<std::string> symbols(const char* section_name) const {
+        return impl_.symbols(section_name);
+    }
+
+    //! \overload std::vector<std::string> symbols(const char* section_name) const
+    std::vector<std::string> symbols(const std::string& section_name) const {
+        return impl_.symbols(section_name.c_str());
+    }
+};
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#endif // BOOST_DLL_LOADED_LIBRARY_INFO_HPP
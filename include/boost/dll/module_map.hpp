@@ -0,0 +1,571 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/module_map.hpp
+/// \brief Contains the boost::dll::module_map class for fast lookups of the loaded binary that holds an address.
+
+#ifndef BOOST_DLL_MODULE_MAP_HPP
+#define BOOST_DLL_MODULE_MAP_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/noncopyable.hpp>
+#include <boost/predef/os.h>
+#include <boost/throw_exception.hpp>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+#if BOOST_OS_WINDOWS
+# if !defined(BOOST_DLL_INTERFACE_UNIT)
+#   include <boost/winapi/dll.hpp>
+#   include <boost/dll/detail/windows/path_from_handle.hpp>
+# endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+#else
+# if !defined(BOOST_DLL_INTERFACE_UNIT)
+#   include <dlfcn.h>
+#   include <boost/dll/detail/posix/program_location_impl.hpp>
+#   if !BOOST_OS_MACOS && !BOOST_OS_IOS && !BOOST_OS_CYGWIN
+#     include <link.h>
+#   endif
+# endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+#endif
+
+#include <boost/dll/detail/aggressive_ptr_cast.hpp>
+#include <boost/dll/detail/system_error.hpp>
+
+/// @cond
+#if !BOOST_OS_WINDOWS && !BOOST_OS_MACOS && !BOOST_OS_IOS && !BOOST_OS_CYGWIN
+#   define BOOST_DLL_DETAIL_HAS_DL_ITERATE_PHDR 1
+#else
+#   define BOOST_DLL_DETAIL_HAS_DL_ITERATE_PHDR 0
+#endif
+/// @endcond
+
+namespace boost { namespace dll {
+
+/// @cond
+namespace detail {
+
+struct module_record {
+    std::uintptr_t          base;
+    std::size_t             id;
+#if BOOST_OS_WINDOWS
+    boost::dll::fs::path    path;
+#else
+    std::string             name;
+    bool                    main_program;   // main program has an empty name in `dl_iterate_phdr`
+#endif
+};
+
+struct module_range {
+    std::uintptr_t          begin;
+    std::uintptr_t          end;
+    const module_record*    module;
+
+    bool operator<(const module_range& rhs) const noexcept {
+        return begin < rhs.begin;
+    }
+};
+
+struct module_snapshot {
+    std::vector<module_range>   ranges;     // sorted by `begin`, do not intersect
+    unsigned long long          adds = 0;   // `dlpi_adds` at the moment of the snapshot creation
+    unsigned long long          subs = 0;   // `dlpi_subs` at the moment of the snapshot creation
+    std::atomic<std::size_t>    readers{0}; // lookups that are running over the snapshot
+};
+
+struct loaded_segment {
+    std::uintptr_t          begin;
+    std::uintptr_t          end;
+    std::size_t             module_index;   // index in the loaded_segments_gather::modules
+};
+
+#if BOOST_DLL_DETAIL_HAS_DL_ITERATE_PHDR
+
+struct loaded_segments_gather {
+    unsigned long long              known_adds;
+    unsigned long long              known_subs;
+    unsigned long long              adds;
+    unsigned long long              subs;
+    bool                            changed;
+    bool                            failed;
+    std::vector<loaded_segment>&    segments;
+    std::vector<std::pair<std::uintptr_t, std::string> >& modules;
+
+    // Exceptions must not propagate through the C code of `dl_iterate_phdr`
+    static int callback(dl_phdr_info* info, std::size_t size, void* data) noexcept {
+        loaded_segments_gather& self = *static_cast<loaded_segments_gather*>(data);
+        try {
+            return self.process(info, size);
+        } catch (...) {
+            self.failed = true;
+            return 1;
+        }
+    }
+
+    int process(dl_phdr_info* info, std::size_t size) {
+        loaded_segments_gather& self = *this;
+
+        if (!self.changed) {
+            // First call. Checking counters of loads and unloads to avoid the rebuild
+            if (size >= offsetof(dl_phdr_info, dlpi_subs) + sizeof(info->dlpi_subs)) {
+                self.adds = info->dlpi_adds;
+                self.subs = info->dlpi_subs;
+                if (self.adds == self.known_adds && self.subs == self.known_subs) {
+                    return 1; // Stop iteration, nothing changed
+                }
+            }
+            self.changed = true;
+        }
+
+        // Name must be copied right now, because the module could be unloaded right after the `dl_iterate_phdr` call
+        self.modules.push_back(std::make_pair(
+            static_cast<std::uintptr_t>(info->dlpi_addr), std::string(info->dlpi_name ? info->dlpi_name : "")
+        ));
+
+        for (std::size_t i = 0; i < info->dlpi_phnum; ++i) {
+            const auto& phdr = info->dlpi_phdr[i];
+            if (phdr.p_type != PT_LOAD || !phdr.p_memsz) {
+                continue;
+            }
+
+            const std::uintptr_t begin = static_cast<std::uintptr_t>(info->dlpi_addr + phdr.p_vaddr);
+            const loaded_segment segment = {
+                begin,
+                begin + static_cast<std::uintptr_t>(phdr.p_memsz),
+                self.modules.size() - 1
+            };
+            self.segments.push_back(segment);
+        }
+
+        return 0;
+    }
+};
+
+#endif // BOOST_DLL_DETAIL_HAS_DL_ITERATE_PHDR
+
+} // namespace detail
+/// @endcond
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+/*!
+* \brief Map of the address ranges of the binaries loaded into the current process.
+*
+* Each lookup is a lock-free binary search over an immutable snapshot of the sorted address ranges,
+* that returns a cheap boost::dll::module_map::loaded_module handle. Path of the binary is materialized only
+* on the boost::dll::module_map::loaded_module::path() call.
+*
+* On platforms with `dl_iterate_phdr` the snapshot holds all the `PT_LOAD` segments and is rebuilt
+* only when the `dlpi_adds` or `dlpi_subs` counters change. On other platforms the modules are added to
+* the snapshot on the first lookup of an address from them: Windows computes the module range from
+* the in memory PE headers, other platforms ask `dladdr` on each lookup that misses the snapshot.
+*
+* Module records are never freed while the map exists, so the handles and the results of lookups stay valid
+* even after the binary is unloaded. Replaced snapshots are reused for the next snapshots after all the lookups
+* over them have finished, so the memory does not grow with the count of the load and unload cycles.
+*/
+class module_map: private boost::noncopyable {
+public:
+    /*!
+    * \brief Cheap handle to a loaded binary. Valid while the boost::dll::module_map that returned it exists.
+    */
+    class loaded_module {
+        const boost::dll::detail::module_record* record_ = nullptr;
+
+    public:
+        /// @cond
+        explicit loaded_module(const boost::dll::detail::module_record* record) noexcept
+            : record_(record)
+        {}
+        /// @endcond
+
+        /*!
+        * Creates an empty handle.
+        * \throws Nothing.
+        */
+        loaded_module() = default;
+
+        /*!
+        * \return true if the handle references a binary.
+        * \throws Nothing.
+        */
+        explicit operator bool() const noexcept {
+            return !!record_;
+        }
+
+        /*!
+        * \return Address at which the binary was loaded. Subtract it from the runtime address
+        * to get an address comparable with the ones from the boost::dll::library_info.
+        * \throws Nothing.
+        */
+        std::uintptr_t base_address() const noexcept {
+            return record_ ? record_->base : 0;
+        }
+
+        /*!
+        * \return Unique within the boost::dll::module_map identifier of the binary. Identifiers
+        * are small integers that could be used as indexes.
+        * \throws Nothing.
+        */
+        std::size_t id() const noexcept {
+            return record_ ? record_->id : static_cast<std::size_t>(-1);
+        }
+
+        /*!
+        * \return Full path to the binary or empty path for an empty handle.
+        * \throws std::bad_alloc in case of insufficient memory.
+        */
+        boost::dll::fs::path path() const {
+#if BOOST_OS_WINDOWS
+            return record_ ? record_->path : boost::dll::fs::path();
+#else
+            return record_ ? boost::dll::fs::path(record_->name) : boost::dll::fs::path();
+#endif
+        }
+
+        /// \return true if both handles reference the same binary.
+        friend bool operator==(const loaded_module& lhs, const loaded_module& rhs) noexcept {
+            return lhs.record_ == rhs.record_;
+        }
+
+        /// \return true if handles reference different binaries.
+        friend bool operator!=(const loaded_module& lhs, const loaded_module& rhs) noexcept {
+            return lhs.record_ != rhs.record_;
+        }
+    };
+
+private:
+    std::atomic<boost::dll::detail::module_snapshot*>                       current_;
+    std::mutex                                                              mutex_;
+    std::vector<std::unique_ptr<boost::dll::detail::module_snapshot> >      snapshots_; // all the descriptors
+    std::vector<boost::dll::detail::module_snapshot*>                       retired_;   // not current, may have readers
+    std::vector<boost::dll::detail::module_snapshot*>                       free_;      // not current, no readers
+    std::vector<std::unique_ptr<boost::dll::detail::module_record> >        records_;
+
+    /// @cond
+    static const boost::dll::detail::module_record* find_in(const boost::dll::detail::module_snapshot& snapshot, std::uintptr_t address) noexcept {
+        const boost::dll::detail::module_range key = { address, address, nullptr };
+        std::vector<boost::dll::detail::module_range>::const_iterator it = std::upper_bound(
+            snapshot.ranges.begin(), snapshot.ranges.end(), key
+        );
+        if (it == snapshot.ranges.begin()) {
+            return nullptr;
+        }
+
+        --it;
+        return (address < it->end ? it->module : nullptr);
+    }
+
+    // Must be called under the `mutex_`
+    const boost::dll::detail::module_record* intern(std::uintptr_t base, const char* name) {
+        for (std::size_t i = records_.size(); i > 0; --i) {
+            const boost::dll::detail::module_record& r = *records_[i - 1];
+#if BOOST_OS_WINDOWS
+            if (r.base == base) {
+#else
+            if (r.base == base && (*name ? r.name == name : r.main_program)) {
+#endif
+                return &r;
+            }
+        }
+
+        std::unique_ptr<boost::dll::detail::module_record> r(new boost::dll::detail::module_record());
+        r->base = base;
+        r->id = records_.size();
+
+#if BOOST_OS_WINDOWS
+        (void)name;
+        std::error_code ec;
+        r->path = boost::dll::detail::path_from_handle(reinterpret_cast<boost::winapi::HMODULE_>(base), ec);
+#else
+        r->main_program = !*name;
+        if (!r->main_program) {
+            r->name = name;
+        } else {
+            std::error_code ec;
+            r->name = boost::dll::detail::program_location_impl(ec).string();
+        }
+#endif
+
+        records_.push_back(std::move(r));
+        return records_.back().get();
+    }
+
+    // Same protocol as in boost::dll::hot_reload_plugin: readers increment the count and then check that the
+    // snapshot is still current. Writers replace the current snapshot and then check the count.
+    boost::dll::detail::module_snapshot* enter() const noexcept {
+        for (;;) {
+            boost::dll::detail::module_snapshot* const snapshot = current_.load(std::memory_order_seq_cst);
+            snapshot->readers.fetch_add(1, std::memory_order_seq_cst);
+            if (current_.load(std::memory_order_seq_cst) == snapshot) {
+                return snapshot;
+            }
+            snapshot->readers.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    static void leave(boost::dll::detail::module_snapshot* snapshot) noexcept {
+        snapshot->readers.fetch_sub(1, std::memory_order_release);
+    }
+
+    // Must be called under the `mutex_`. Returns an empty descriptor, that stays free until publish().
+    boost::dll::detail::module_snapshot& unused_snapshot() {
+        if (free_.empty()) {
+            // Reserving first, so that publish() does not allocate
+            snapshots_.reserve(snapshots_.size() + 1);
+            retired_.reserve(snapshots_.size() + 1);
+            free_.reserve(snapshots_.size() + 1);
+            snapshots_.emplace_back(new boost::dll::detail::module_snapshot());
+            free_.push_back(snapshots_.back().get());
+        }
+
+        boost::dll::detail::module_snapshot& snapshot = *free_.back();
+        snapshot.ranges.clear();
+        snapshot.adds = 0;
+        snapshot.subs = 0;
+        return snapshot;
+    }
+
+    // Must be called under the `mutex_`. Publishes the descriptor from the unused_snapshot().
+    void publish() noexcept {
+        boost::dll::detail::module_snapshot* const snapshot = free_.back();
+        free_.pop_back();
+        std::sort(snapshot->ranges.begin(), snapshot->ranges.end());
+
+        boost::dll::detail::module_snapshot* const old = current_.exchange(snapshot, std::memory_order_seq_cst);
+        if (old) {
+            retired_.push_back(old);
+        }
+
+        for (std::size_t i = 0; i < retired_.size();) {
+            if (retired_[i]->readers.load(std::memory_order_seq_cst)) {
+                ++i;
+                continue;
+            }
+
+            free_.push_back(retired_[i]);
+            retired_[i] = retired_.back();
+            retired_.pop_back();
+        }
+    }
+
+    // Must be called under the `mutex_`
+    bool add_module_of(const void* ptr) {
+#if BOOST_DLL_DETAIL_HAS_DL_ITERATE_PHDR
+        (void)ptr;
+        return false;
+#elif BOOST_OS_WINDOWS
+        boost::winapi::MEMORY_BASIC_INFORMATION_ mbi;
+        if (!boost::winapi::VirtualQuery(ptr, &mbi, sizeof(mbi)) || !mbi.AllocationBase) {
+            return false;
+        }
+
+        // `SizeOfImage` from the IMAGE_OPTIONAL_HEADER has the same offset for 32 and 64 bit binaries
+        const unsigned char* base = static_cast<const unsigned char*>(mbi.AllocationBase);
+        if (base[0] != 'M' || base[1] != 'Z') {
+            return false;
+        }
+        const std::int32_t e_lfanew = *reinterpret_cast<const std::int32_t*>(base + 0x3c);
+        const std::uint32_t size_of_image = *reinterpret_cast<const std::uint32_t*>(base + e_lfanew + 4 + 20 + 56);
+
+        const boost::dll::detail::module_record* record = intern(reinterpret_cast<std::uintptr_t>(base), "");
+        const boost::dll::detail::module_snapshot* old = current_.load(std::memory_order_relaxed);
+        boost::dll::detail::module_snapshot& snapshot = unused_snapshot();
+        const boost::dll::detail::module_range range = {
+            reinterpret_cast<std::uintptr_t>(base), reinterpret_cast<std::uintptr_t>(base) + size_of_image, record
+        };
+
+        // Module could be reloaded at the same address with different size
+        snapshot.ranges.reserve(old->ranges.size() + 1);
+        for (std::size_t i = 0; i < old->ranges.size(); ++i) {
+            if (!(old->ranges[i].begin < range.end && range.begin < old->ranges[i].end)) {
+                snapshot.ranges.push_back(old->ranges[i]);
+            }
+        }
+        snapshot.ranges.push_back(range);
+        publish();
+        return true;
+#else
+        (void)ptr;
+        return false;
+#endif
+    }
+
+    const boost::dll::detail::module_record* query_os(const void* ptr) {
+#if !BOOST_OS_WINDOWS && !BOOST_DLL_DETAIL_HAS_DL_ITERATE_PHDR
+        Dl_info info;
+
+        // Some of the libc headers miss `const` in `dladdr(const void*, Dl_info*)`
+        if (!dladdr(const_cast<void*>(ptr), &info)) {
+            boost::dll::detail::reset_dlerror();
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return intern(reinterpret_cast<std::uintptr_t>(info.dli_fbase), info.dli_fname ? info.dli_fname : "");
+#else
+        (void)ptr;
+        return nullptr;
+#endif
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Creates the map and fills it with the currently loaded binaries.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    module_map()
+        : current_(nullptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        unused_snapshot();
+        publish();
+        refresh_impl();
+    }
+
+    /*!
+    * Finds the binary that holds the address in the current snapshot without any locking or system calls.
+    *
+    * \param ptr Address to look up.
+    * \return Handle to the binary or empty handle if the address is not in the current snapshot.
+    * \throws Nothing.
+    */
+    loaded_module find_cached(const void* ptr) const noexcept {
+        boost::dll::detail::module_snapshot* const snapshot = enter();
+        const boost::dll::detail::module_record* const record = find_in(*snapshot, reinterpret_cast<std::uintptr_t>(ptr));
+        leave(snapshot);
+        return loaded_module(record);
+    }
+
+    /*!
+    * Finds the binary that holds the address. If the address is not in the current snapshot,
+    * refreshes the snapshot and looks up again.
+    *
+    * \param ptr Address to look up.
+    * \return Handle to the binary or empty handle if the address does not belong to any loaded binary.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    loaded_module find(const void* ptr) {
+        loaded_module ret = find_cached(ptr);
+        if (ret || !ptr) {
+            return ret;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (refresh_impl() || add_module_of(ptr)) {
+                ret = find_cached(ptr);
+            }
+        }
+
+        if (!ret) {
+            ret = loaded_module(query_os(ptr));
+        }
+
+        return ret;
+    }
+
+    //! \overload loaded_module find(const void* ptr)
+    template <class T>
+    loaded_module find_symbol(const T& symbol) {
+        return find(boost::dll::detail::aggressive_ptr_cast<const void*>(std::addressof(symbol)));
+    }
+
+    /*!
+    * Rereads the list of the loaded binaries if it changed since the last refresh. Old snapshot is reused
+    * only after the concurrent lookups over it have finished, so they are not affected.
+    *
+    * \return true if a new snapshot was published.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    bool refresh() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return refresh_impl();
+    }
+
+    /*!
+    * \return Count of the address ranges in the current snapshot.
+    * \throws Nothing.
+    */
+    std::size_t size() const noexcept {
+        boost::dll::detail::module_snapshot* const snapshot = enter();
+        const std::size_t ret = snapshot->ranges.size();
+        leave(snapshot);
+        return ret;
+    }
+
+private:
+    /// @cond
+    // Must be called under the `mutex_`
+    bool refresh_impl() {
+#if BOOST_DLL_DETAIL_HAS_DL_ITERATE_PHDR
+        const boost::dll::detail::module_snapshot* old = current_.load(std::memory_order_relaxed);
+
+        std::vector<boost::dll::detail::loaded_segment> segments;
+        std::vector<std::pair<std::uintptr_t, std::string> > modules;
+        segments.reserve(old->ranges.size() + 16);
+        boost::dll::detail::loaded_segments_gather gather = { old->adds, old->subs, 0, 0, false, false, segments, modules };
+
+        dl_iterate_phdr(&boost::dll::detail::loaded_segments_gather::callback, &gather);
+        if (gather.failed) {
+            boost::throw_exception(std::bad_alloc());
+        }
+        if (!gather.changed) {
+            return false;
+        }
+
+        boost::dll::detail::module_snapshot& snapshot = unused_snapshot();
+        snapshot.adds = gather.adds;
+        snapshot.subs = gather.subs;
+        snapshot.ranges.reserve(segments.size());
+        for (std::size_t i = 0; i < segments.size(); ++i) {
+            const std::pair<std::uintptr_t, std::string>& m = modules[segments[i].module_index];
+            const boost::dll::detail::module_range range = {
+                segments[i].begin, segments[i].end, intern(m.first, m.second.c_str())
+            };
+            snapshot.ranges.push_back(range);
+        }
+
+        publish();
+        return true;
+#else
+        return false;
+#endif
+    }
+    /// @endcond
+};
+
+BOOST_DLL_END_MODULE_EXPORT
+
+}} // namespace boost::dll
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#endif // BOOST_DLL_MODULE_MAP_HPP
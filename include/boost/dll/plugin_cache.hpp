@@ -0,0 +1,306 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/plugin_cache.hpp
+/// \brief Contains the boost::dll::plugin_cache class that unloads idle plugins and reloads them on demand.
+
+#ifndef BOOST_DLL_PLUGIN_CACHE_HPP
+#define BOOST_DLL_PLUGIN_CACHE_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/import.hpp>
+#include <boost/dll/shared_library.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/noncopyable.hpp>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Cache of loaded plugins that unloads the plugins that are not in use and transparently reloads them
+* on the next access.
+*
+* Each symbol imported through the cache holds a lease on its plugin. Plugin is considered idle when all
+* the symbols imported from it, and all their copies, are destroyed. Idle plugins are unloaded:
+* - by trim() if they were idle for longer than the idle timeout;
+* - on loading of another plugin, in least recently used order, if the total size of the loaded plugins
+*   exceeds the size budget. Size of a plugin is approximated by the size of its file.
+*
+* Plugins that are in use are never unloaded, so the size budget may be exceeded if all the plugins are in use.
+* All the member functions are thread safe. Plugins are loaded under the internal lock of the cache.
+*/
+class plugin_cache: private boost::noncopyable {
+public:
+    /// Clock that is used for the idle timeout.
+    using clock_type = std::chrono::steady_clock;
+
+private:
+    /// @cond
+    struct entry {
+        boost::dll::detail::shared_ptr<shared_library>  library;    // guarded by mutex_ of the cache
+        std::uintmax_t                                  size = 0;
+        std::atomic<std::size_t>                        leases{0};
+        std::atomic<clock_type::rep>                    last_use{0};
+    };
+
+    using entry_ptr = boost::dll::detail::shared_ptr<entry>;
+
+    // Deleter of a lease. Copies of the lease share the same deleter, so it is called once per lease.
+    class lease_releaser {
+        entry_ptr                                       entry_;
+        boost::dll::detail::shared_ptr<shared_library>  library_;
+
+    public:
+        lease_releaser(entry_ptr e, boost::dll::detail::shared_ptr<shared_library> library) noexcept
+            : entry_(std::move(e))
+            , library_(std::move(library))
+        {}
+
+        void operator()(shared_library*) noexcept {
+            entry_->last_use.store(clock_type::now().time_since_epoch().count(), std::memory_order_relaxed);
+
+            // Release the library before the lease, so that the library is unloaded as soon as the cache drops it
+            library_.reset();
+            entry_->leases.fetch_sub(1, std::memory_order_release);
+        }
+    };
+
+    const clock_type::duration                      idle_timeout_;
+    const std::uintmax_t                            size_budget_;
+    const load_mode::type                           mode_;
+
+    mutable std::mutex                              mutex_;
+    std::map<boost::dll::fs::path, entry_ptr>       entries_;
+    std::uintmax_t                                  loaded_size_ = 0;
+
+    static bool is_idle(const entry& e) noexcept {
+        return !e.leases.load(std::memory_order_acquire);
+    }
+
+    void unload(std::map<boost::dll::fs::path, entry_ptr>::iterator it) noexcept {
+        loaded_size_ -= it->second->size;
+        entries_.erase(it);
+    }
+
+    // Unloads idle plugins in least recently used order until `required` more bytes fit into the budget
+    void evict_for(std::uintmax_t required) noexcept {
+        while (loaded_size_ > size_budget_ || size_budget_ - loaded_size_ < required) {
+            std::map<boost::dll::fs::path, entry_ptr>::iterator lru = entries_.end();
+            for (std::map<boost::dll::fs::path, entry_ptr>::iterator it = entries_.begin(); it != entries_.end(); ++it) {
+                if (is_idle(*it->second) && (lru == entries_.end()
+                    || it->second->last_use.load(std::memory_order_relaxed) < lru->second->last_use.load(std::memory_order_relaxed)))
+                {
+                    lru = it;
+                }
+            }
+
+            if (lru == entries_.end()) {
+                return; // All the plugins are in use
+            }
+
+            unload(lru);
+        }
+    }
+
+    boost::dll::detail::shared_ptr<shared_library> lease(const boost::dll::fs::path& plugin_path) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::map<boost::dll::fs::path, entry_ptr>::iterator it = entries_.find(plugin_path);
+        if (it == entries_.end()) {
+            entry_ptr loaded = boost::dll::detail::make_shared<entry>();
+            loaded->library = boost::dll::detail::make_shared<shared_library>(plugin_path, mode_);
+
+            boost::dll::fs::error_code ec;
+            const std::uintmax_t size = boost::dll::fs::file_size(loaded->library->location(), ec);
+            loaded->size = (ec ? 0 : size);
+
+            evict_for(loaded->size);
+            it = entries_.emplace(plugin_path, std::move(loaded)).first;
+            loaded_size_ += it->second->size;
+        }
+
+        const entry_ptr& e = it->second;
+        e->leases.fetch_add(1, std::memory_order_relaxed);
+        e->last_use.store(clock_type::now().time_since_epoch().count(), std::memory_order_relaxed);
+
+        // On exception the constructor calls the deleter, that releases the lease
+        return boost::dll::detail::shared_ptr<shared_library>(e->library.get(), lease_releaser(e, e->library));
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Creates an empty cache.
+    *
+    * \param idle_timeout Time after which idle plugins are unloaded by trim().
+    * \param size_budget Maximal total size of the files of the loaded plugins in bytes.
+    * \param mode A mode that will be used on plugins load.
+    * \throws Nothing.
+    */
+    explicit plugin_cache(clock_type::duration idle_timeout = (clock_type::duration::max)(),
+        std::uintmax_t size_budget = (std::numeric_limits<std::uintmax_t>::max)(),
+        load_mode::type mode = load_mode::default_mode) noexcept
+        : idle_timeout_(idle_timeout)
+        , size_budget_(size_budget)
+        , mode_(mode)
+    {}
+
+    /*!
+    * Loads the plugin if it is not loaded and returns a lease on it.
+    *
+    * \param plugin_path Path to the plugin.
+    * \return Shared pointer to the plugin, that keeps the plugin loaded while the pointer or its copies exist.
+    * \throws \forcedlinkfs{system_error} if the plugin could not be loaded, std::bad_alloc in case
+    * of insufficient memory.
+    */
+    boost::dll::detail::shared_ptr<shared_library> library(const boost::dll::fs::path& plugin_path) {
+        return lease(plugin_path);
+    }
+
+    /*!
+    * Loads the plugin if it is not loaded and imports the symbol as boost::dll::import_symbol does.
+    *
+    * \b Template \b parameter \b T: Type of the symbol that we are going to import. Must be explicitly specified.
+    *
+    * \param plugin_path Path to the plugin.
+    * \param symbol_name Name of the symbol.
+    * \return Callable object or shared pointer that keeps the plugin loaded.
+    * \throws \forcedlinkfs{system_error} if the plugin could not be loaded or the symbol does not exist,
+    * std::bad_alloc in case of insufficient memory.
+    */
+    template <class T>
+    boost::dll::detail::import_type<T> get(const boost::dll::fs::path& plugin_path, const char* symbol_name) {
+        boost::dll::detail::shared_ptr<shared_library> lib = lease(plugin_path);
+        T* const symbol = std::addressof(lib->get<T>(symbol_name));
+        return boost::dll::detail::import_type<T>(std::move(lib), symbol);
+    }
+
+    //! \overload boost::dll::detail::import_type<T> get(const boost::dll::fs::path& plugin_path, const char* symbol_name)
+    template <class T>
+    boost::dll::detail::import_type<T> get(const boost::dll::fs::path& plugin_path, const std::string& symbol_name) {
+        return get<T>(plugin_path, symbol_name.c_str());
+    }
+
+    /*!
+    * Loads the plugin if it is not loaded and imports the alias as boost::dll::import_alias does.
+    *
+    * \b Template \b parameter \b T: Type of the symbol alias that we are going to import. Must be explicitly specified.
+    *
+    * \param plugin_path Path to the plugin.
+    * \param alias_name Name of the alias.
+    * \return Callable object or shared pointer that keeps the plugin loaded.
+    * \throws \forcedlinkfs{system_error} if the plugin could not be loaded or the alias does not exist,
+    * std::bad_alloc in case of insufficient memory.
+    */
+    template <class T>
+    boost::dll::detail::import_type<T> get_alias(const boost::dll::fs::path& plugin_path, const char* alias_name) {
+        boost::dll::detail::shared_ptr<shared_library> lib = lease(plugin_path);
+        T* const symbol = lib->get<T*>(alias_name);
+        return boost::dll::detail::import_type<T>(std::move(lib), symbol);
+    }
+
+    //! \overload boost::dll::detail::import_type<T> get_alias(const boost::dll::fs::path& plugin_path, const char* alias_name)
+    template <class T>
+    boost::dll::detail::import_type<T> get_alias(const boost::dll::fs::path& plugin_path, const std::string& alias_name) {
+        return get_alias<T>(plugin_path, alias_name.c_str());
+    }
+
+    /*!
+    * Unloads the plugins that are idle for longer than the idle timeout.
+    *
+    * \param now Current time.
+    * \return Count of the unloaded plugins.
+    * \throws Nothing.
+    */
+    std::size_t trim(clock_type::time_point now = clock_type::now()) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::size_t unloaded = 0;
+        for (std::map<boost::dll::fs::path, entry_ptr>::iterator it = entries_.begin(); it != entries_.end();) {
+            const clock_type::time_point last_use(clock_type::duration(it->second->last_use.load(std::memory_order_relaxed)));
+            if (!is_idle(*it->second) || now - last_use < idle_timeout_) {
+                ++it;
+                continue;
+            }
+
+            unload(it++);
+            ++unloaded;
+        }
+
+        return unloaded;
+    }
+
+    /*!
+    * Unloads all the idle plugins.
+    *
+    * \return Count of the unloaded plugins.
+    * \throws Nothing.
+    */
+    std::size_t unload_idle() noexcept {
+        return trim((clock_type::time_point::max)());
+    }
+
+    /*!
+    * \param plugin_path Path to the plugin.
+    * \return true if the plugin is loaded by the cache.
+    * \throws Nothing.
+    */
+    bool is_loaded(const boost::dll::fs::path& plugin_path) const noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.find(plugin_path) != entries_.end();
+    }
+
+    /*!
+    * \return Count of the plugins loaded by the cache.
+    * \throws Nothing.
+    */
+    std::size_t loaded_count() const noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    /*!
+    * \return Total size of the files of the plugins loaded by the cache.
+    * \throws Nothing.
+    */
+    std::uintmax_t loaded_size() const noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return loaded_size_;
+    }
+};
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#endif // BOOST_DLL_PLUGIN_CACHE_HPP
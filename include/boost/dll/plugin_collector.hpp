@@ -0,0 +1,278 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/plugin_collector.hpp
+/// \brief Contains the boost::dll::plugin_collector class that discovers and loads plugins using multiple threads.
+
+#ifndef BOOST_DLL_PLUGIN_COLLECTOR_HPP
+#define BOOST_DLL_PLUGIN_COLLECTOR_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/import.hpp>
+#include <boost/dll/library_info.hpp>
+#include <boost/dll/shared_library.hpp>
+#include <boost/dll/detail/worker_pool.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/noncopyable.hpp>
+#include <boost/throw_exception.hpp>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+#include <boost/dll/detail/system_error.hpp>
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Discovers plugins in directories and loads them using a bounded pool of threads.
+*
+* Plugin is a binary that exports a factory of type `T` via the \forcedmacrolink{BOOST_DLL_ALIAS} with the name
+* that is passed to the constructor. Each candidate file is first checked by cheap header parsing with
+* boost::dll::library_info: files that are not native binaries or do not export the factory are skipped
+* without loading them. Remaining files are loaded and their factories are imported as
+* boost::dll::import_alias does, so each factory keeps its library loaded.
+*
+* Discovered factories are published into a map from the path of the plugin, that is guarded by a mutex.
+* All the member functions are thread safe, so the factories could be queried while other threads
+* collect plugins.
+*
+* \b Template \b parameter \b T: Type of the factory, for example `std::shared_ptr<my_plugin_api>()`.
+*/
+template <class T>
+class plugin_collector: private boost::noncopyable {
+public:
+    /// Callable object or smart pointer that holds the imported factory and its library, see
+    /// boost::dll::import_alias.
+    using factory_type = boost::dll::detail::import_type<T>;
+
+    /// Map from the path of the plugin to its factory.
+    using map_type = std::map<boost::dll::fs::path, factory_type>;
+
+private:
+    const std::string               factory_name_;
+    const load_mode::type           mode_;
+
+    mutable std::mutex              mutex_;
+    map_type                        factories_;
+
+    /// @cond
+    class loader {
+        plugin_collector&                           collector_;
+        const std::vector<boost::dll::fs::path>&    paths_;
+        boost::dll::detail::worker_pool             pool_;
+        std::atomic<std::size_t>                    added_;
+        std::mutex                                  error_mutex_;
+        std::exception_ptr                          error_;
+
+    public:
+        loader(plugin_collector& collector, const std::vector<boost::dll::fs::path>& paths) noexcept
+            : collector_(collector)
+            , paths_(paths)
+            , pool_(paths.size())
+            , added_(0)
+        {}
+
+        void operator()(std::size_t /*worker_index*/, std::size_t job_index) noexcept {
+            try {
+                if (collector_.load(paths_[job_index])) {
+                    added_.fetch_add(1, std::memory_order_relaxed);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex_);
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+                pool_.stop();
+            }
+        }
+
+        std::size_t run(std::size_t workers) {
+            pool_.run(workers, *this);
+            if (error_) {
+                std::rethrow_exception(error_);
+            }
+            return added_.load(std::memory_order_relaxed);
+        }
+    };
+
+    bool is_collected(const boost::dll::fs::path& path) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return factories_.find(path) != factories_.end();
+    }
+
+    bool exports_factory(const boost::dll::fs::path& path) const {
+        try {
+            boost::dll::library_info info(path);
+            return info.has_symbol(factory_name_);
+        } catch (const std::bad_alloc&) {
+            throw;
+        } catch (...) {
+            // Not a binary, not a native binary or the file is not readable
+            return false;
+        }
+    }
+
+    // Returns true if the new factory was added. Throws only in case of insufficient memory.
+    bool load(const boost::dll::fs::path& path) {
+        if (is_collected(path) || !exports_factory(path)) {
+            return false;
+        }
+
+        std::error_code ec;
+        boost::dll::shared_library lib(path, ec, mode_);
+        if (ec || !lib.has(factory_name_)) {
+            return false;
+        }
+
+        factory_type factory = boost::dll::import_alias<T>(std::move(lib), factory_name_);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return factories_.emplace(path, std::move(factory)).second;
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Creates an empty collector.
+    *
+    * \param factory_name Name of the alias of the factory that each plugin must export.
+    * \param mode A mode that will be used on plugins load.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    explicit plugin_collector(std::string factory_name, load_mode::type mode = load_mode::default_mode)
+        : factory_name_(std::move(factory_name))
+        , mode_(mode)
+    {}
+
+    /*!
+    * Checks and loads the plugins using a pool of threads and publishes their factories.
+    *
+    * Files that are not plugins, that fail to load or that were already collected are skipped.
+    *
+    * \param paths Paths to the candidate files.
+    * \param threads Maximal count of threads to use, including the calling thread. 0 means
+    * `std::thread::hardware_concurrency()`.
+    * \return Count of the newly added factories.
+    * \throws std::bad_alloc in case of insufficient memory. In that case the not yet processed files
+    * are skipped, already added factories remain in the collector.
+    */
+    std::size_t collect(const std::vector<boost::dll::fs::path>& paths, std::size_t threads = 0) {
+        if (paths.empty()) {
+            return 0;
+        }
+
+        loader l(*this, paths);
+        return l.run(boost::dll::detail::workers_count(threads, paths.size()));
+    }
+
+    /*!
+    * Recursively collects all the regular files from the `directory` and collects plugins from them as
+    * collect(const std::vector<boost::dll::fs::path>&, std::size_t) does.
+    *
+    * \param directory Directory to search for plugins.
+    * \param threads Maximal count of threads to use, including the calling thread. 0 means
+    * `std::thread::hardware_concurrency()`.
+    * \return Count of the newly added factories.
+    * \throws \forcedlinkfs{system_error} if the directory could not be traversed, std::bad_alloc in case
+    * of insufficient memory.
+    */
+    std::size_t collect(const boost::dll::fs::path& directory, std::size_t threads = 0) {
+        std::vector<boost::dll::fs::path> paths;
+
+        boost::dll::fs::recursive_directory_iterator endit;
+        for (boost::dll::fs::recursive_directory_iterator it(directory); it != endit; ++it) {
+            if (boost::dll::fs::is_regular_file(*it)) {
+                paths.push_back(it->path());
+            }
+        }
+
+        return collect(paths, threads);
+    }
+
+    /*!
+    * \return Count of the collected factories.
+    * \throws Nothing.
+    */
+    std::size_t size() const noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return factories_.size();
+    }
+
+    /*!
+    * \return true if no factories were collected.
+    * \throws Nothing.
+    */
+    bool empty() const noexcept {
+        return !size();
+    }
+
+    /*!
+    * \param path Path to the plugin, exactly as it was passed to or found by collect().
+    * \return true if the factory of the plugin was collected.
+    * \throws Nothing.
+    */
+    bool has(const boost::dll::fs::path& path) const noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return factories_.find(path) != factories_.end();
+    }
+
+    /*!
+    * \param path Path to the plugin, exactly as it was passed to or found by collect().
+    * \return Factory of the plugin.
+    * \throws \forcedlinkfs{system_error} if the factory of the plugin was not collected.
+    */
+    factory_type get(const boost::dll::fs::path& path) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const typename map_type::const_iterator it = factories_.find(path);
+        if (it == factories_.end()) {
+            boost::throw_exception(boost::dll::fs::system_error(
+                std::make_error_code(std::errc::invalid_argument),
+                "boost::dll::plugin_collector::get() failed: plugin was not collected"
+            ));
+        }
+
+        return it->second;
+    }
+
+    /*!
+    * \return Copy of the map from the paths of the plugins to their factories.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    map_type factories() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return factories_;
+    }
+};
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#endif // BOOST_DLL_PLUGIN_COLLECTOR_HPP
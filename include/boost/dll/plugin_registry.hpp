@@ -0,0 +1,411 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/plugin_registry.hpp
+/// \brief Contains the BOOST_DLL_REGISTER macro and the boost::dll::plugin_registry class for enumerating
+/// the registered plugins of a loaded library without reading its file and without looking up each symbol.
+
+#ifndef BOOST_DLL_PLUGIN_REGISTRY_HPP
+#define BOOST_DLL_PLUGIN_REGISTRY_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/alias.hpp>
+#include <boost/dll/shared_library.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/predef/compiler.h>
+#include <boost/predef/os.h>
+#include <boost/type_index/ctti_type_index.hpp>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <system_error>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+#include <boost/dll/detail/aggressive_ptr_cast.hpp>
+#include <boost/dll/detail/name_hash.hpp>
+
+#if !BOOST_OS_WINDOWS
+#   include <boost/dll/detail/posix/loaded_image_impl.hpp>
+#endif
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Descriptor of a plugin that is placed into the registry section of the binary by the
+* \forcedmacrolink{BOOST_DLL_REGISTER} macro.
+*
+* Entries are over-aligned, so that compilers that increase the alignment of big objects leave no gaps between
+* the entries in the section.
+*/
+struct alignas(32) registry_entry {
+    /// Hash of the `name`, see boost::dll::registry_hash().
+    std::uint64_t   name_hash;
+
+    /// Null-terminated alias name of the plugin.
+    const char*     name;
+
+    /// Raw boost::typeindex::ctti_type_index name of the registered function or variable type.
+    const char*     type_name;
+
+    /// Address of the registered function or variable.
+    void*           address;
+
+    /*!
+    * Returns the address of the registered function or variable if its type exactly matches `T`.
+    *
+    * \code
+    * std::size_t(*f)(const std::vector<int>&) = entry.as<std::size_t(const std::vector<int>&)>();
+    * int* i = entry.as<int>();
+    * \endcode
+    *
+    * \tparam T Type of the registered function or variable, including cv-qualifiers.
+    * \return Pointer to the function or variable or nullptr if the type differs.
+    * \throws Nothing.
+    */
+    template <class T>
+    T* as() const noexcept {
+        if (std::strcmp(type_name, boost::typeindex::ctti_type_index::type_id_with_cvr<T>().raw_name())) {
+            return nullptr;
+        }
+
+        return boost::dll::detail::aggressive_ptr_cast<T*>(address);
+    }
+};
+
+/*!
+* Compile time hash of the plugin name that is stored in boost::dll::registry_entry::name_hash.
+* \param name Null-terminated name.
+* \return 64 bit FNV-1a hash of the name.
+* \throws Nothing.
+*/
+constexpr std::uint64_t registry_hash(const char* name) noexcept {
+    return boost::dll::detail::name_hash(name);
+}
+
+/*!
+* \brief View of the plugins registered with \forcedmacrolink{BOOST_DLL_REGISTER} in a loaded library.
+*
+* Registry is located with a single symbol lookup, after that all the plugins are enumerated by walking the
+* registry section of the library in memory. Binary file is not read.
+*
+* View points directly to the memory of the library and is valid while the library is loaded.
+*/
+class plugin_registry {
+    const boost::dll::registry_entry*   begin_ = nullptr;
+    const boost::dll::registry_entry*   end_ = nullptr;
+
+    /// @cond
+    typedef void (registry_bounds_t)(const boost::dll::registry_entry**, const boost::dll::registry_entry**);
+
+    void init(const boost::dll::shared_library& lib, std::error_code& ec) {
+        if (!lib.has("boost_dll_registry")) {
+            ec = std::make_error_code(std::errc::invalid_argument);
+            return;
+        }
+
+        registry_bounds_t& accessor = lib.get<registry_bounds_t>("boost_dll_registry");
+
+#if !BOOST_OS_WINDOWS
+        // Each registry has the same name and `dlsym` also searches the dependencies of the library. Registry of
+        // a dependency must not be reported as the registry of the library.
+        boost::dll::detail::loaded_image_impl image;
+        image.init(lib.native(), ec);
+        if (ec || !image.contains(boost::dll::detail::aggressive_ptr_cast<const void*>(&accessor))) {
+            ec = std::make_error_code(std::errc::invalid_argument);
+            return;
+        }
+#endif
+
+        accessor(&begin_, &end_);
+    }
+    /// @endcond
+
+public:
+    /*!
+    * \brief Forward iterator over the registered plugins.
+    */
+    class const_iterator {
+        const boost::dll::registry_entry*   pos_ = nullptr;
+        const boost::dll::registry_entry*   end_ = nullptr;
+
+        /// @cond
+        void skip_padding() noexcept {
+            // Linkers may put zero padding between the entries from different translation units
+            while (pos_ != end_ && !pos_->name) {
+                ++pos_;
+            }
+        }
+        /// @endcond
+
+    public:
+        typedef std::forward_iterator_tag           iterator_category;
+        typedef boost::dll::registry_entry          value_type;
+        typedef std::ptrdiff_t                      difference_type;
+        typedef const boost::dll::registry_entry*   pointer;
+        typedef const boost::dll::registry_entry&   reference;
+
+        const_iterator() = default;
+
+        /// @cond
+        const_iterator(const boost::dll::registry_entry* pos, const boost::dll::registry_entry* end) noexcept
+            : pos_(pos)
+            , end_(end)
+        {
+            skip_padding();
+        }
+        /// @endcond
+
+        reference operator*() const noexcept { return *pos_; }
+        pointer operator->() const noexcept { return pos_; }
+
+        const_iterator& operator++() noexcept {
+            ++pos_;
+            skip_padding();
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept {
+            const_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& rhs) const noexcept { return pos_ == rhs.pos_; }
+        bool operator!=(const const_iterator& rhs) const noexcept { return pos_ != rhs.pos_; }
+    };
+
+    /*!
+    * Creates empty registry.
+    * \throws Nothing.
+    */
+    plugin_registry() = default;
+
+    /*!
+    * Locates the registry of the loaded library.
+    *
+    * \param lib Loaded library that was built with at least one \forcedmacrolink{BOOST_DLL_REGISTER}.
+    * \throws \forcedlinkfs{system_error} if the library is not loaded or has no registry.
+    */
+    explicit plugin_registry(const boost::dll::shared_library& lib) {
+        std::error_code ec;
+        init(lib, ec);
+        if (ec) {
+            boost::dll::detail::report_error(ec, "boost::dll::plugin_registry::plugin_registry() failed: library has no registry");
+        }
+    }
+
+    /*!
+    * Locates the registry of the loaded library.
+    *
+    * \param lib Loaded library that was built with at least one \forcedmacrolink{BOOST_DLL_REGISTER}.
+    * \param ec Variable that will be set to the result of the operation.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    plugin_registry(const boost::dll::shared_library& lib, std::error_code& ec) {
+        ec.clear();
+        init(lib, ec);
+    }
+
+    /*!
+    * \return Iterator to the first registered plugin.
+    * \throws Nothing.
+    */
+    const_iterator begin() const noexcept {
+        return const_iterator(begin_, end_);
+    }
+
+    /*!
+    * \return Iterator past the last registered plugin.
+    * \throws Nothing.
+    */
+    const_iterator end() const noexcept {
+        return const_iterator(end_, end_);
+    }
+
+    /*!
+    * \return true if there are no registered plugins.
+    * \throws Nothing.
+    */
+    bool empty() const noexcept {
+        return begin() == end();
+    }
+
+    /*!
+    * Finds the plugin by its alias name. Names are compared only for the entries with the same hash.
+    *
+    * \param name Null-terminated alias name of the plugin.
+    * \return Pointer to the registry entry or nullptr if there is no plugin with such name.
+    * \throws Nothing.
+    */
+    const boost::dll::registry_entry* find(const char* name) const noexcept {
+        const std::uint64_t hash = boost::dll::registry_hash(name);
+        for (const boost::dll::registry_entry* it = begin_; it != end_; ++it) {
+            if (it->name_hash == hash && it->name && !std::strcmp(it->name, name)) {
+                return it;
+            }
+        }
+
+        return nullptr;
+    }
+
+    //! \overload const boost::dll::registry_entry* find(const char* name) const noexcept
+    const boost::dll::registry_entry* find(const std::string& name) const noexcept {
+        return find(name.c_str());
+    }
+};
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+
+/// @cond
+// Bounds of the registry section. Each binary gets its own bounds, so they are declared hidden.
+#if BOOST_OS_WINDOWS
+
+#   if defined(_MSC_VER)
+#       pragma section("boostreg$a", read, write)
+#       pragma section("boostreg$m", read, write)
+#       pragma section("boostreg$z", read, write)
+#       define BOOST_DLL_DETAIL_REGISTRY_ENTRY_SECTION __declspec(allocate("boostreg$m"))
+#       define BOOST_DLL_DETAIL_REGISTRY_MARKER(Name, Suffix) \
+            __declspec(allocate("boostreg$" #Suffix)) __declspec(selectany) boost::dll::registry_entry Name = {}
+#   else
+#       define BOOST_DLL_DETAIL_REGISTRY_ENTRY_SECTION __attribute__((section("boostreg$m"), used))
+#       define BOOST_DLL_DETAIL_REGISTRY_MARKER(Name, Suffix) \
+            __attribute__((section("boostreg$" #Suffix), selectany)) boost::dll::registry_entry Name = {}
+#   endif
+
+// Linker sorts the `boostreg$*` sections by the suffix and merges them into a single `boostreg` section
+extern "C" {
+BOOST_DLL_DETAIL_REGISTRY_MARKER(boost_dll_registry_first, a);
+BOOST_DLL_DETAIL_REGISTRY_MARKER(boost_dll_registry_last, z);
+}
+
+#   define BOOST_DLL_DETAIL_REGISTRY_BEGIN (&boost_dll_registry_first + 1)
+#   define BOOST_DLL_DETAIL_REGISTRY_END (&boost_dll_registry_last)
+
+#elif BOOST_OS_MACOS || BOOST_OS_IOS
+
+#   define BOOST_DLL_DETAIL_REGISTRY_ENTRY_SECTION __attribute__((section("__DATA,boostreg"), used))
+
+extern boost::dll::registry_entry boost_dll_registry_begin[] __asm("section$start$__DATA$boostreg") __attribute__((visibility("hidden")));
+extern boost::dll::registry_entry boost_dll_registry_end[] __asm("section$end$__DATA$boostreg") __attribute__((visibility("hidden")));
+
+#   define BOOST_DLL_DETAIL_REGISTRY_BEGIN boost_dll_registry_begin
+#   define BOOST_DLL_DETAIL_REGISTRY_END boost_dll_registry_end
+
+#else
+
+#   define BOOST_DLL_DETAIL_REGISTRY_ENTRY_SECTION __attribute__((section("boostreg"), used))
+
+extern "C" __attribute__((visibility("hidden"))) boost::dll::registry_entry __start_boostreg[];
+extern "C" __attribute__((visibility("hidden"))) boost::dll::registry_entry __stop_boostreg[];
+
+#   define BOOST_DLL_DETAIL_REGISTRY_BEGIN __start_boostreg
+#   define BOOST_DLL_DETAIL_REGISTRY_END __stop_boostreg
+
+#endif
+
+// Exported from each binary that has registry entries. It is emitted only if the BOOST_DLL_REGISTER macro was used,
+// so binaries without the registry do not reference the bounds of a non existing section.
+extern "C" BOOST_SYMBOL_EXPORT inline void boost_dll_registry(
+    const boost::dll::registry_entry** begin, const boost::dll::registry_entry** end) noexcept
+{
+    *begin = BOOST_DLL_DETAIL_REGISTRY_BEGIN;
+    *end = BOOST_DLL_DETAIL_REGISTRY_END;
+}
+
+#if defined(_MSC_VER)
+#   define BOOST_DLL_DETAIL_REGISTRY_ANCHOR(AliasName)
+#else
+#   define BOOST_DLL_DETAIL_REGISTRY_ANCHOR(AliasName)                                            \
+    __attribute__((used)) static void (* const AliasName ## _anchor)(                              \
+        const boost::dll::registry_entry**, const boost::dll::registry_entry**) = &boost_dll_registry; \
+    /**/
+#endif
+/// @endcond
+
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+/*!
+* \brief Makes an alias name for exported function or variable and registers it in the registry section of the binary.
+*
+* Works as the \forcedmacrolink{BOOST_DLL_ALIAS} and additionally puts a boost::dll::registry_entry with the name,
+* name hash, type and address of the function or variable into the `boostreg` section. All the registered plugins of
+* a loaded library could be enumerated via boost::dll::plugin_registry without reading the binary file.
+*
+* \param FunctionOrVar Function or variable for which an alias must be made.
+* \param AliasName Name of the alias. Must be a valid C identifier.
+*
+* \b Example:
+* \code
+* namespace foo {
+*   void bar(std::string&);
+* }
+* BOOST_DLL_REGISTER(foo::bar, foo_bar)
+* \endcode
+*
+* Host side:
+* \code
+* boost::dll::shared_library lib("/path/to/plugin");
+* for (const boost::dll::registry_entry& entry : boost::dll::plugin_registry(lib)) {
+*   if (auto f = entry.as<void(std::string&)>()) {
+*       // ...
+*   }
+* }
+* \endcode
+*
+* \b Puts: `AliasName` into `boostdll` section and a registry entry into `boostreg` section.
+*/
+#define BOOST_DLL_REGISTER(FunctionOrVar, AliasName)                                            \
+    BOOST_DLL_REGISTER_SECTIONED(FunctionOrVar, AliasName, boostdll)                            \
+    /**/
+
+/*!
+* \brief Same as \forcedmacrolink{BOOST_DLL_REGISTER} but puts the alias name into the user specified section.
+*
+* \param FunctionOrVar Function or variable for which an alias must be made.
+* \param AliasName Name of the alias. Must be a valid C identifier.
+* \param SectionName Name of the section for the alias, see \forcedmacrolink{BOOST_DLL_ALIAS_SECTIONED}.
+* Registry entry is always placed into the `boostreg` section.
+*/
+#define BOOST_DLL_REGISTER_SECTIONED(FunctionOrVar, AliasName, SectionName)                     \
+    BOOST_DLL_ALIAS_SECTIONED(FunctionOrVar, AliasName, SectionName)                            \
+    namespace _autoregistry {                                                                   \
+        BOOST_DLL_DETAIL_REGISTRY_ENTRY_SECTION                                                 \
+        static boost::dll::registry_entry AliasName = {                                         \
+            boost::dll::registry_hash(#AliasName),                                              \
+            #AliasName,                                                                         \
+            boost::typeindex::ctti_type_index::type_id_with_cvr<                                \
+                decltype(FunctionOrVar)                                                         \
+            >().raw_name(),                                                                     \
+            reinterpret_cast<void*>(reinterpret_cast<intptr_t>(&FunctionOrVar))                 \
+        };                                                                                      \
+        BOOST_DLL_DETAIL_REGISTRY_ANCHOR(AliasName)                                             \
+    } /* namespace _autoregistry */                                                             \
+    /**/
+
+#endif // BOOST_DLL_PLUGIN_REGISTRY_HPP
@@ -26,7 +26,10 @@
 #include <boost/predef/compiler/visualc.h>
 
 #if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <atomic>
 #include <memory>  // std::addressof
+#include <mutex>
+#include <vector>
 #endif // !defined(BOOST_DLL_USE_STD_MODULE)
 #endif // !defined(BOOST_DLL_INTERFACE_UNIT)
 
@@ -70,6 +73,70 @@ namespace detail {
 } // namespace detail
 #endif
 
+namespace detail {
+    // Lazily resolved path. All the published paths are kept alive, so references
+    // returned to users stay valid after refresh().
+    class cached_path {
+        std::atomic<const boost::dll::fs::path*>                current_;
+        std::mutex                                              mutex_;
+        std::vector<std::unique_ptr<boost::dll::fs::path> >     paths_;
+
+        template <class Resolver>
+        const boost::dll::fs::path* publish(Resolver resolver, std::error_code& ec) {
+            boost::dll::fs::path p = resolver(ec);
+            if (ec) {
+                return nullptr;
+            }
+
+            paths_.emplace_back(new boost::dll::fs::path(std::move(p)));
+            current_.store(paths_.back().get(), std::memory_order_release);
+            return paths_.back().get();
+        }
+
+    public:
+        cached_path() noexcept
+            : current_(nullptr)
+        {}
+
+        cached_path(const cached_path&) = delete;
+        cached_path& operator=(const cached_path&) = delete;
+
+        template <class Resolver>
+        const boost::dll::fs::path* get(Resolver resolver, std::error_code& ec) {
+            ec.clear();
+            const boost::dll::fs::path* p = current_.load(std::memory_order_acquire);
+            if (p) {
+                return p;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            p = current_.load(std::memory_order_relaxed);
+            if (p) {
+                return p;
+            }
+
+            return publish(resolver, ec);
+        }
+
+        template <class Resolver>
+        const boost::dll::fs::path* refresh(Resolver resolver, std::error_code& ec) {
+            ec.clear();
+            std::lock_guard<std::mutex> lock(mutex_);
+            return publish(resolver, ec);
+        }
+    };
+
+    inline cached_path& program_location_cache() {
+        static cached_path cache;
+        return cache;
+    }
+
+    inline const boost::dll::fs::path& empty_path() noexcept {
+        static const boost::dll::fs::path p;
+        return p;
+    }
+} // namespace detail
+
 BOOST_DLL_BEGIN_MODULE_EXPORT
 
     /*!
@@ -230,6 +297,55 @@ BOOST_DLL_BEGIN_MODULE_EXPORT
         return ret;
     }
 
+    /*!
+    * Same as program_location(), but resolves the path only once per process. Concurrent calls are thread safe.
+    *
+    * \param ec Variable that will be set to the result of the operation.
+    * \return Reference to the path that is valid till the end of the program, even after refresh_program_location().
+    * Reference to an empty path in case of error.
+    * \throws std::bad_alloc in case of insufficient memory. Overload that does not accept \forcedlinkfs{error_code} also throws \forcedlinkfs{system_error}.
+    */
+    inline const boost::dll::fs::path& program_location_cached(std::error_code& ec) {
+        const boost::dll::fs::path* p = boost::dll::detail::program_location_cache().get(
+            &boost::dll::detail::program_location_impl, ec
+        );
+        return p ? *p : boost::dll::detail::empty_path();
+    }
+
+    //! \overload program_location_cached(std::error_code& ec)
+    inline const boost::dll::fs::path& program_location_cached() {
+        std::error_code ec;
+        const boost::dll::fs::path& ret = boost::dll::program_location_cached(ec);
+
+        if (ec) {
+            boost::dll::detail::report_error(ec, "boost::dll::program_location_cached() failed");
+        }
+
+        return ret;
+    }
+
+    /*!
+    * Resolves the path to the currently running program once again and makes program_location_cached() return it.
+    * Useful if the executable was replaced on disk. References returned by previous program_location_cached()
+    * calls stay valid.
+    *
+    * \param ec Variable that will be set to the result of the operation.
+    * \throws std::bad_alloc in case of insufficient memory. Overload that does not accept \forcedlinkfs{error_code} also throws \forcedlinkfs{system_error}.
+    */
+    inline void refresh_program_location(std::error_code& ec) {
+        boost::dll::detail::program_location_cache().refresh(&boost::dll::detail::program_location_impl, ec);
+    }
+
+    //! \overload refresh_program_location(std::error_code& ec)
+    inline void refresh_program_location() {
+        std::error_code ec;
+        boost::dll::refresh_program_location(ec);
+
+        if (ec) {
+            boost::dll::detail::report_error(ec, "boost::dll::refresh_program_location() failed");
+        }
+    }
+
 BOOST_DLL_END_MODULE_EXPORT
 
 }} // namespace boost::dll
@@ -277,6 +393,35 @@ static inline boost::dll::fs::path this_line_location() {
     return ret;
 }
 
+/*!
+* Same as this_line_location(), but resolves the path only once per translation unit, that is at least
+* once per binary. Concurrent calls are thread safe.
+*
+* \param ec Variable that will be set to the result of the operation.
+* \return Reference to the path that is valid till the end of the program. Reference to an empty path in case of error.
+* \throws std::bad_alloc in case of insufficient memory. Overload that does not accept \forcedlinkfs{error_code} also throws \forcedlinkfs{system_error}.
+*/
+static inline const boost::dll::fs::path& this_line_location_cached(std::error_code& ec) {
+    typedef boost::dll::fs::path(func_t)(std::error_code& );
+    static boost::dll::detail::cached_path cache;
+
+    func_t& f = this_line_location;
+    const boost::dll::fs::path* p = cache.get(&f, ec);
+    return p ? *p : boost::dll::detail::empty_path();
+}
+
+//! \overload this_line_location_cached(std::error_code& ec)
+static inline const boost::dll::fs::path& this_line_location_cached() {
+    std::error_code ec;
+    const boost::dll::fs::path& ret = this_line_location_cached(ec);
+
+    if (ec) {
+        boost::dll::detail::report_error(ec, "boost::dll::this_line_location_cached() failed");
+    }
+
+    return ret;
+}
+
 /// @cond
 } // anonymous namespace
 /// @endcond
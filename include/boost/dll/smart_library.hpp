@@ -87,11 +87,18 @@ BOOST_DLL_BEGIN_MODULE_EXPORT
 * \endcode
 *
 * This does however not happen when the value is set inside the constructor function.
+*
+* Loaded constructors, destructors and type infos are cached, so that only the first request for a type searches
+* the symbols. Copies of the smart_library share the symbols and the cache until the symbols or type aliases of a
+* copy change.
 */
 class smart_library {
     shared_library lib_;
+    // Symbols and the cache of the resolved constructors, destructors and type infos
     detail::mangled_storage_impl storage_;
 
+    template<typename Class> struct type_info_key;
+
 public:
     /*!
      * Get the underlying shared_library
@@ -300,7 +307,10 @@ public:
      */
     template<typename Signature>
     constructor<Signature> get_constructor() const {
-        return boost::dll::detail::load_ctor<Signature>(lib_, storage_.get_constructor<Signature>());
+        auto resolve = [this]() {
+            return boost::dll::detail::load_ctor<Signature>(lib_, storage_.get_constructor<Signature>());
+        };
+        return storage_.cached<constructor<Signature>, constructor<Signature>>(resolve);
     }
 
     /*!
@@ -322,7 +332,10 @@ public:
      */
     template<typename Class>
     destructor<Class> get_destructor() const {
-        return boost::dll::detail::load_dtor<Class>(lib_, storage_.get_destructor<Class>());
+        auto resolve = [this]() {
+            return boost::dll::detail::load_dtor<Class>(lib_, storage_.get_destructor<Class>());
+        };
+        return storage_.cached<destructor<Class>, destructor<Class>>(resolve);
     }
     /*!
      * Load the typeinfo of the given type.
@@ -344,7 +357,10 @@ public:
     template<typename Class>
     const std::type_info& get_type_info() const
     {
-        return boost::dll::detail::load_type_info<Class>(lib_, storage_);
+        auto resolve = [this]() {
+            return &boost::dll::detail::load_type_info<Class>(lib_, storage_);
+        };
+        return *storage_.cached<type_info_key<Class>, const std::type_info*>(resolve);
     }
     /**
      * This function can be used to add a type alias.
@@ -0,0 +1,134 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/static_alias.hpp
+/// \brief Contains the BOOST_DLL_DECLARE_STATIC_ALIAS macro and the boost::dll::import_static_alias function
+/// that bind the aliases of statically linked plugins at link time.
+
+#ifndef BOOST_DLL_STATIC_ALIAS_HPP
+#define BOOST_DLL_STATIC_ALIAS_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/import.hpp>
+#include <boost/dll/runtime_symbol_info.hpp>
+
+#include <boost/dll/detail/aggressive_ptr_cast.hpp>
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+#ifdef BOOST_DLL_DOXYGEN
+/// Define this macro in the program that links all the plugins statically, to bind the aliases declared by
+/// \forcedmacrolink{BOOST_DLL_DECLARE_STATIC_ALIAS} at link time instead of looking them up in the program
+/// at runtime. Plugins themselves are built without changes.
+#define BOOST_DLL_STATIC_PLUGINS
+#endif
+
+#if defined(BOOST_DLL_STATIC_PLUGINS) || defined(BOOST_DLL_DOXYGEN)
+
+/*!
+* Returns the function or variable of the plugin that is linked into the program, see
+* \forcedmacrolink{BOOST_DLL_DECLARE_STATIC_ALIAS}.
+*
+* If \forcedmacrolink{BOOST_DLL_STATIC_PLUGINS} is defined, the alias is bound by the linker and the
+* result is a plain pointer to the function or variable. No symbol lookup is done and the program is not
+* required to export its symbols. The alias is a variable that holds the address of the function or variable,
+* so each call loads that address at runtime and the calls through the result are not inlined.
+*
+* Otherwise the alias is imported from boost::dll::program_location() as boost::dll::import_alias does and
+* the result is the boost::dll::import_alias result. Calls and dereferences are written the same way
+* for both results.
+*
+* \b Template \b parameter \b Alias: Tag that was declared by the \forcedmacrolink{BOOST_DLL_DECLARE_STATIC_ALIAS},
+* `_static_aliases::AliasName`. Must be explicitly specified.
+*
+* \return Pointer to the function or variable if \forcedmacrolink{BOOST_DLL_STATIC_PLUGINS} is defined,
+* boost::dll::import_alias result otherwise.
+*
+* \throws Nothing if \forcedmacrolink{BOOST_DLL_STATIC_PLUGINS} is defined. Otherwise
+* \forcedlinkfs{system_error} if the program does not export the alias, std::bad_alloc in case of insufficient memory.
+*/
+template <class Alias>
+inline typename Alias::type* import_static_alias() noexcept {
+    return boost::dll::detail::aggressive_ptr_cast<typename Alias::type*>(Alias::address());
+}
+
+#else
+
+template <class Alias>
+inline boost::dll::detail::import_type<typename Alias::type> import_static_alias() {
+    return boost::dll::import_alias<typename Alias::type>(boost::dll::program_location(), Alias::name());
+}
+
+#endif
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+/// @cond
+#if defined(BOOST_DLL_STATIC_PLUGINS)
+// Same declaration as the one from BOOST_DLL_ALIAS, so the linker binds it to the alias of the plugin
+#   define BOOST_DLL_DETAIL_STATIC_ALIAS_ADDRESS(AliasName)                                     \
+    namespace _autoaliases {                                                                    \
+        extern "C" const void *AliasName;                                                       \
+    } /* namespace _autoaliases */                                                              \
+    /**/
+#   define BOOST_DLL_DETAIL_STATIC_ALIAS_ADDRESS_MEMBER(AliasName)                              \
+        static const void* address() noexcept { return _autoaliases::AliasName; }               \
+    /**/
+#else
+#   define BOOST_DLL_DETAIL_STATIC_ALIAS_ADDRESS(AliasName)
+#   define BOOST_DLL_DETAIL_STATIC_ALIAS_ADDRESS_MEMBER(AliasName)
+#endif
+/// @endcond
+
+/*!
+* \brief Declares the alias of a plugin that may be linked into the program statically.
+*
+* Must be used at namespace scope of the program, not of the plugin. Plugin exports the alias with the
+* \forcedmacrolink{BOOST_DLL_ALIAS} as usual. Declares a tag `_static_aliases::AliasName` in the current namespace
+* for the boost::dll::import_static_alias.
+*
+* If \forcedmacrolink{BOOST_DLL_STATIC_PLUGINS} is defined, the alias is referenced directly, so the plugin
+* must be linked into the program and the linker does not drop it from a static library.
+*
+* \param Type Type of the function or variable, for example `std::shared_ptr<my_plugin_api>()`.
+* \param AliasName Name of the alias. Must be a valid C identifier.
+*
+* \b Example:
+* \code
+* BOOST_DLL_DECLARE_STATIC_ALIAS(std::shared_ptr<my_plugin_api>(), create_plugin)
+*
+* int main() {
+*   auto creator = boost::dll::import_static_alias<_static_aliases::create_plugin>();
+*   std::shared_ptr<my_plugin_api> plugin = creator();
+* }
+* \endcode
+*/
+#define BOOST_DLL_DECLARE_STATIC_ALIAS(Type, AliasName)                                         \
+    BOOST_DLL_DETAIL_STATIC_ALIAS_ADDRESS(AliasName)                                            \
+    namespace _static_aliases {                                                                 \
+        struct AliasName {                                                                      \
+            using type = Type;                                                                  \
+            static const char* name() noexcept { return #AliasName; }                           \
+            BOOST_DLL_DETAIL_STATIC_ALIAS_ADDRESS_MEMBER(AliasName)                             \
+        };                                                                                      \
+    } /* namespace _static_aliases */                                                           \
+    /**/
+
+#endif // BOOST_DLL_STATIC_ALIAS_HPP
@@ -0,0 +1,251 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/symbol_index.hpp
+/// \brief Contains only the boost::dll::symbol_index class that maps addresses of a binary file to symbols.
+
+#ifndef BOOST_DLL_SYMBOL_INDEX_HPP
+#define BOOST_DLL_SYMBOL_INDEX_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/library_info.hpp>
+#include <boost/dll/symbol_info.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Result of the boost::dll::symbol_index lookup.
+*/
+struct symbol_lookup_result {
+    /// Name of the symbol that contains the address or nullptr if there is no such symbol.
+    /// Points to the storage of boost::dll::symbol_index and is valid while the index exists.
+    const char* name = nullptr;
+
+    /// Address of the beginning of the symbol, see boost::dll::symbol_info::address.
+    std::uint64_t symbol_address = 0;
+
+    /// Offset of the looked up address from the beginning of the symbol.
+    std::uint64_t offset = 0;
+
+    /// Size of the symbol or 0 if unknown.
+    std::uint64_t size = 0;
+
+    /// \return true if the symbol was found.
+    explicit operator bool() const noexcept {
+        return !!name;
+    }
+};
+
+/*!
+* \brief Immutable index for address to symbol queries over the symbols of a binary file. Works for files that
+* are not loaded into the process and could be safely used from multiple threads.
+*
+* Addresses are the values stored in the binary (see boost::dll::symbol_info::address), so for a loaded library
+* the load address of the library must be subtracted from the runtime address before the lookup.
+*
+* Symbol addresses are kept in a separate sorted array for cache friendly binary search and all the names
+* are stored in a single buffer.
+*/
+class symbol_index {
+    std::vector<std::uint64_t>  addresses_;
+    std::vector<std::uint64_t>  sizes_;
+    std::vector<std::size_t>    name_offsets_;
+    std::string                 names_;
+
+    /// @cond
+    struct by_address {
+        bool operator()(const boost::dll::symbol_info* lhs, const boost::dll::symbol_info* rhs) const noexcept {
+            // Among the symbols with the same address the one with the biggest size is preferred
+            return lhs->address < rhs->address || (lhs->address == rhs->address && lhs->size > rhs->size);
+        }
+    };
+
+    void init(const std::vector<boost::dll::symbol_info>& symbols) {
+        std::vector<const boost::dll::symbol_info*> sorted;
+        sorted.reserve(symbols.size());
+
+        std::size_t names_size = 0;
+        for (std::size_t i = 0; i < symbols.size(); ++i) {
+            if (symbols[i].address && !symbols[i].name.empty()) {
+                sorted.push_back(&symbols[i]);
+                names_size += symbols[i].name.size() + 1;
+            }
+        }
+        std::stable_sort(sorted.begin(), sorted.end(), by_address());
+
+        addresses_.reserve(sorted.size());
+        sizes_.reserve(sorted.size());
+        name_offsets_.reserve(sorted.size());
+        names_.reserve(names_size);
+        for (std::size_t i = 0; i < sorted.size(); ++i) {
+            if (!addresses_.empty() && addresses_.back() == sorted[i]->address) {
+                continue; // Alias of the previous symbol
+            }
+
+            addresses_.push_back(sorted[i]->address);
+            sizes_.push_back(sorted[i]->size);
+            name_offsets_.push_back(names_.size());
+            names_.append(sorted[i]->name.c_str(), sorted[i]->name.size() + 1);
+        }
+    }
+
+    boost::dll::symbol_lookup_result make_result(std::size_t upper, std::uint64_t address) const noexcept {
+        boost::dll::symbol_lookup_result res;
+        if (!upper) {
+            return res; // Address is before the first symbol
+        }
+
+        const std::size_t i = upper - 1;
+        const std::uint64_t offset = address - addresses_[i];
+        if (sizes_[i] && offset >= sizes_[i]) {
+            return res; // Address is after the end of the symbol
+        }
+
+        res.name = names_.c_str() + name_offsets_[i];
+        res.symbol_address = addresses_[i];
+        res.offset = offset;
+        res.size = sizes_[i];
+        return res;
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Creates an empty index.
+    * \throws Nothing.
+    */
+    symbol_index() = default;
+
+    /*!
+    * Creates index from the symbols.
+    * \param symbols Symbols to index. Symbols with zero address or empty name are ignored.
+    * \throws std::bad_alloc.
+    */
+    explicit symbol_index(const std::vector<boost::dll::symbol_info>& symbols) {
+        init(symbols);
+    }
+
+    /*!
+    * Creates index from the symbols of the binary file.
+    * \param info Binary file information, see boost::dll::library_info::symbols_info().
+    * \throws std::exception based exceptions.
+    */
+    explicit symbol_index(boost::dll::library_info& info) {
+        init(info.symbols_info());
+    }
+
+    /*!
+    * Creates index from the symbols of the binary file. The file is not loaded.
+    * \param library_path Path to the binary file. Binaries of any supported format are accepted.
+    * \throws std::exception based exceptions.
+    */
+    explicit symbol_index(const boost::dll::fs::path& library_path) {
+        boost::dll::library_info info(library_path, false);
+        init(info.symbols_info());
+    }
+
+    /*!
+    * \return Count of indexed symbols.
+    * \throws Nothing.
+    */
+    std::size_t size() const noexcept {
+        return addresses_.size();
+    }
+
+    /*!
+    * \return true if there are no indexed symbols.
+    * \throws Nothing.
+    */
+    bool empty() const noexcept {
+        return addresses_.empty();
+    }
+
+    /*!
+    * Finds the symbol that contains the address. For symbols of unknown size the nearest
+    * symbol with lower or same address is returned.
+    *
+    * \param address Address to look up.
+    * \return Symbol and offset in it, or empty result if there is no symbol for the address.
+    * \throws Nothing.
+    */
+    boost::dll::symbol_lookup_result lookup(std::uint64_t address) const noexcept {
+        const std::size_t upper = static_cast<std::size_t>(
+            std::upper_bound(addresses_.begin(), addresses_.end(), address) - addresses_.begin()
+        );
+        return make_result(upper, address);
+    }
+
+    /*!
+    * Looks up a batch of addresses that are sorted in ascending order. Each next address is searched starting
+    * from the position of the previous one, so the whole batch is processed in a single pass over the index.
+    *
+    * \param addresses Pointer to the sorted array of addresses.
+    * \param count Count of the addresses.
+    * \param results Pointer to the array of at least `count` results, that receives the lookup result for each address.
+    * \throws Nothing.
+    */
+    void lookup_sorted(const std::uint64_t* addresses, std::size_t count, boost::dll::symbol_lookup_result* results) const noexcept {
+        std::size_t pos = 0;
+        const std::size_t symbols_count = addresses_.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint64_t address = addresses[i];
+
+            // Galloping search from the previous position: near addresses are found in a few steps
+            std::size_t step = 1;
+            std::size_t hi = pos;
+            while (hi < symbols_count && addresses_[hi] <= address) {
+                pos = hi + 1;
+                hi += step;
+                step *= 2;
+            }
+            if (hi > symbols_count) {
+                hi = symbols_count;
+            }
+
+            pos = static_cast<std::size_t>(
+                std::upper_bound(addresses_.begin() + pos, addresses_.begin() + hi, address) - addresses_.begin()
+            );
+            results[i] = make_result(pos, address);
+        }
+    }
+
+    //! \overload void lookup_sorted(const std::uint64_t* addresses, std::size_t count, boost::dll::symbol_lookup_result* results) const noexcept
+    std::vector<boost::dll::symbol_lookup_result> lookup_sorted(const std::vector<std::uint64_t>& addresses) const {
+        std::vector<boost::dll::symbol_lookup_result> results(addresses.size());
+        if (!addresses.empty()) {
+            lookup_sorted(&addresses[0], addresses.size(), &results[0]);
+        }
+        return results;
+    }
+};
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#endif // BOOST_DLL_SYMBOL_INDEX_HPP
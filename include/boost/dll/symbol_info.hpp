@@ -0,0 +1,95 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/symbol_info.hpp
+/// \brief Contains only the boost::dll::symbol_info structure that describes a symbol
+/// of a binary file, see boost::dll::library_info::symbols_info().
+
+#ifndef BOOST_DLL_SYMBOL_INFO_HPP
+#define BOOST_DLL_SYMBOL_INFO_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Kind of the entity that is referenced by the symbol.
+*/
+enum class symbol_type {
+    unknown,            ///< Type is not specified in the binary or could not be deduced
+    object,             ///< Variable or any other data
+    function,           ///< Function or other executable code
+    common,             ///< Uninitialized common block (ELF only)
+    tls,                ///< Thread local variable (ELF only)
+    indirect_function   ///< GNU indirect function that is resolved at load time (ELF only)
+};
+
+/*!
+* \brief Visibility of the symbol for the linker.
+*/
+enum class symbol_binding {
+    local,              ///< Symbol is not visible outside of the binary
+    global,             ///< Symbol is visible to all the binaries
+    weak,               ///< Symbol is visible to all the binaries and may be overridden
+    unique              ///< GNU unique symbol, only one definition is used in process (ELF only)
+};
+
+/*!
+* \brief Information about a symbol extracted from a binary file without loading it.
+*/
+struct symbol_info {
+    /// Name of the symbol without the version suffix.
+    std::string name;
+
+    /// Value of the symbol as stored in the binary: `st_value` for ELF, export RVA for PE and `n_value` for Mach-O.
+    /// For shared libraries that is an offset from the load address of the library.
+    std::uint64_t address = 0;
+
+    /// Size of the symbol in bytes or 0 if the size is unknown. PE and Mach-O formats do not store symbol sizes.
+    std::uint64_t size = 0;
+
+    /// Kind of the symbol.
+    boost::dll::symbol_type type = boost::dll::symbol_type::unknown;
+
+    /// Linkage of the symbol.
+    boost::dll::symbol_binding binding = boost::dll::symbol_binding::global;
+
+    /// Index of the section that contains the symbol. For PE and Mach-O indexes start from 1.
+    std::size_t section_index = 0;
+
+    /// GNU version of the symbol from `.gnu.version_d` or `.gnu.version_r`, empty if the symbol is not versioned.
+    std::string version;
+
+    /// `true` if this is the default version of the symbol, that is used for linking new binaries (`name@@version`).
+    /// `false` for hidden versions (`name@version`).
+    bool default_version = true;
+};
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#endif // BOOST_DLL_SYMBOL_INFO_HPP
@@ -0,0 +1,206 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file boost/dll/symbolizer.hpp
+/// \brief Contains the boost::dll::symbolizer class for batch symbolization of code addresses of the current process.
+
+#ifndef BOOST_DLL_SYMBOLIZER_HPP
+#define BOOST_DLL_SYMBOLIZER_HPP
+
+#include <boost/dll/detail/config.hpp>
+
+#if !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/dll/config.hpp>
+#include <boost/dll/module_map.hpp>
+#include <boost/dll/symbol_index.hpp>
+
+#if !defined(BOOST_DLL_INTERFACE_UNIT)
+#include <boost/noncopyable.hpp>
+
+#if !defined(BOOST_DLL_USE_STD_MODULE)
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#endif // !defined(BOOST_DLL_USE_STD_MODULE)
+#endif // !defined(BOOST_DLL_INTERFACE_UNIT)
+
+BOOST_DLL_BEGIN_MODULE_EXPORT
+
+namespace boost { namespace dll {
+
+/*!
+* \brief Result of the symbolization of a single address, see boost::dll::symbolizer::symbolize().
+*/
+struct symbolized_address {
+    /// Binary that holds the address or empty handle if the address does not belong to any loaded binary.
+    boost::dll::module_map::loaded_module module;
+
+    /// Offset of the address from the load address of the binary.
+    std::uintptr_t module_offset = 0;
+
+    /// Name of the symbol that holds the address or nullptr if unknown. Points to the storage
+    /// of boost::dll::symbolizer and is valid while the symbolizer exists.
+    const char* symbol_name = nullptr;
+
+    /// Offset of the address from the beginning of the symbol.
+    std::uint64_t symbol_offset = 0;
+};
+
+/*!
+* \brief Batch symbolizer of the addresses of the current process.
+*
+* Addresses are sorted internally, so the binaries and their symbol tables are scanned in a single
+* ordered pass. Symbol tables are read from the binary files on first use and are kept in boost::dll::symbol_index
+* per binary. Scratch buffers are reused between the calls, so symbolization of the addresses from already
+* known binaries does not allocate.
+*
+* Calls to symbolize() are serialized.
+*/
+class symbolizer: private boost::noncopyable {
+    std::unique_ptr<boost::dll::module_map>                     own_map_;
+    boost::dll::module_map&                                     map_;
+
+    std::mutex                                                  mutex_;
+    std::vector<std::unique_ptr<boost::dll::symbol_index> >     indexes_;   // by module id
+    std::vector<std::pair<std::uintptr_t, std::size_t> >        sorted_;    // address and its index in the input
+    std::vector<std::uint64_t>                                  offsets_;
+    std::vector<boost::dll::symbol_lookup_result>               results_;
+
+    /// @cond
+    const boost::dll::symbol_index& index_of(const boost::dll::module_map::loaded_module& m) {
+        if (indexes_.size() <= m.id()) {
+            indexes_.resize(m.id() + 1);
+        }
+
+        std::unique_ptr<boost::dll::symbol_index>& index = indexes_[m.id()];
+        if (!index) {
+            try {
+                index.reset(new boost::dll::symbol_index(m.path()));
+            } catch (const std::bad_alloc&) {
+                throw;
+            } catch (...) {
+                // Binary has no file on disk (for example `linux-vdso.so.1`) or the file is not readable
+                index.reset(new boost::dll::symbol_index());
+            }
+        }
+
+        return *index;
+    }
+
+    void symbolize_group(std::size_t begin, std::size_t end, const boost::dll::module_map::loaded_module& m,
+        boost::dll::symbolized_address* out)
+    {
+        const std::uintptr_t base = m.base_address();
+        offsets_.clear();
+        for (std::size_t i = begin; i < end; ++i) {
+            offsets_.push_back(sorted_[i].first - base);
+        }
+        results_.resize(offsets_.size());
+
+        const boost::dll::symbol_index& index = index_of(m);
+        index.lookup_sorted(&offsets_[0], offsets_.size(), &results_[0]);
+
+        for (std::size_t i = begin; i < end; ++i) {
+            boost::dll::symbolized_address& res = out[sorted_[i].second];
+            const boost::dll::symbol_lookup_result& sym = results_[i - begin];
+            res.module = m;
+            res.module_offset = static_cast<std::uintptr_t>(offsets_[i - begin]);
+            res.symbol_name = sym.name;
+            res.symbol_offset = sym.offset;
+        }
+    }
+    /// @endcond
+
+public:
+    /*!
+    * Creates symbolizer with its own boost::dll::module_map.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    symbolizer()
+        : own_map_(new boost::dll::module_map())
+        , map_(*own_map_)
+    {}
+
+    /*!
+    * Creates symbolizer that uses the provided boost::dll::module_map. The map must outlive the symbolizer.
+    * \throws Nothing.
+    */
+    explicit symbolizer(boost::dll::module_map& map) noexcept
+        : map_(map)
+    {}
+
+    /*!
+    * Symbolizes the addresses.
+    *
+    * \param addresses Pointer to the array of addresses in any order.
+    * \param count Count of the addresses.
+    * \param out Pointer to the array of at least `count` elements that receives the result for each address.
+    * \throws std::bad_alloc in case of insufficient memory.
+    */
+    void symbolize(const void* const* addresses, std::size_t count, boost::dll::symbolized_address* out) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        sorted_.clear();
+        sorted_.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            sorted_.push_back(std::make_pair(reinterpret_cast<std::uintptr_t>(addresses[i]), i));
+        }
+        std::sort(sorted_.begin(), sorted_.end());
+
+        std::size_t group_begin = 0;
+        boost::dll::module_map::loaded_module group_module;
+        for (std::size_t i = 0; i < sorted_.size(); ++i) {
+            const boost::dll::module_map::loaded_module m = map_.find(reinterpret_cast<const void*>(sorted_[i].first));
+            if (i && m == group_module) {
+                continue;
+            }
+
+            if (i && group_module) {
+                symbolize_group(group_begin, i, group_module, out);
+            } else {
+                for (std::size_t j = group_begin; j < i; ++j) {
+                    out[sorted_[j].second] = boost::dll::symbolized_address();
+                }
+            }
+            group_begin = i;
+            group_module = m;
+        }
+
+        if (group_module) {
+            symbolize_group(group_begin, sorted_.size(), group_module, out);
+        } else {
+            for (std::size_t j = group_begin; j < sorted_.size(); ++j) {
+                out[sorted_[j].second] = boost::dll::symbolized_address();
+            }
+        }
+    }
+
+    //! \overload void symbolize(const void* const* addresses, std::size_t count, boost::dll::symbolized_address* out)
+    std::vector<boost::dll::symbolized_address> symbolize(const std::vector<const void*>& addresses) {
+        std::vector<boost::dll::symbolized_address> ret(addresses.size());
+        if (!addresses.empty()) {
+            symbolize(&addresses[0], addresses.size(), &ret[0]);
+        }
+        return ret;
+    }
+};
+
+}} // namespace boost::dll
+
+BOOST_DLL_END_MODULE_EXPORT
+
+#endif // !defined(BOOST_USE_MODULES) || defined(BOOST_DLL_INTERFACE_UNIT)
+
+#endif // BOOST_DLL_SYMBOLIZER_HPP
@@ -34,10 +34,18 @@ module;
 
 #ifndef BOOST_DLL_USE_STD_MODULE
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
 #include <type_traits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 #endif
 
@@ -58,6 +66,18 @@ import std;
 #endif
 
 #include <boost/dll.hpp>
+#include <boost/dll/library_scanner.hpp>
+#include <boost/dll/symbol_index.hpp>
+#include <boost/dll/module_map.hpp>
+#include <boost/dll/symbolizer.hpp>
+#include <boost/dll/plugin_registry.hpp>
+#include <boost/dll/plugin_collector.hpp>
+#include <boost/dll/lazy_plugin.hpp>
+#include <boost/dll/plugin_cache.hpp>
+#include <boost/dll/hot_reload.hpp>
+#include <boost/dll/alias_table.hpp>
+#include <boost/dll/static_alias.hpp>
+#include <boost/dll/loaded_library_info.hpp>
 
 // Experimental features
 #include <boost/dll/import_class.hpp>
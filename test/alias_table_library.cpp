@@ -0,0 +1,43 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+// MinGW related workaround
+#define BOOST_DLL_FORCE_ALIAS_INSTANTIATION
+
+#include <boost/dll/alias_table.hpp>
+
+#include <string>
+#include <vector>
+
+namespace table {
+    int increment(int i) { return i + 1; }
+    int decrement(int i) { return i - 1; }
+    int twice(int i) { return i * 2; }
+    int square(int i) { return i * i; }
+    int negate(int i) { return -i; }
+
+    std::size_t size(const std::vector<int>& v) {
+        return v.size();
+    }
+
+    std::string name("alias_table_library");
+    int counter = 7;
+}
+
+#define ALIAS_TABLE_LIBRARY_ALIASES(X)          \
+    X(table::increment, table_increment)        \
+    X(table::decrement, table_decrement)        \
+    X(table::twice, table_twice)                \
+    X(table::square, table_square)              \
+    X(table::negate, table_negate)              \
+    X(table::size, table_size)                  \
+    X(table::name, table_name)                  \
+    X(table::counter, table_counter)            \
+    /**/
+
+BOOST_DLL_ALIAS_TABLE(alias_table_library_table, ALIAS_TABLE_LIBRARY_ALIASES)
@@ -0,0 +1,92 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/alias_table.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+static void test_layout() {
+    constexpr const char* names[] = {
+        "a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l", "m",
+        "n", "o", "p", "q", "r", "s", "t", "u", "v", "w", "x", "y", "z",
+        "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta"
+    };
+    constexpr std::size_t size = sizeof(names) / sizeof(names[0]);
+    constexpr auto layout = dll::detail::make_alias_table_layout(names);
+    static_assert(layout.ok, "");
+
+    constexpr std::size_t buckets = sizeof(layout.seeds) / sizeof(layout.seeds[0]);
+    bool seen[size] = {};
+    for (std::size_t i = 0; i < size; ++i) {
+        const std::uint64_t hash = dll::detail::name_hash(names[i]);
+        const std::size_t slot = dll::detail::alias_table_slot(hash, layout.seeds[hash % buckets], size);
+        BOOST_TEST_EQ(layout.keys[slot], i);
+        BOOST_TEST(!seen[slot]);
+        seen[slot] = true;
+    }
+
+    constexpr const char* duplicates[] = {"a", "b", "a"};
+    static_assert(!dll::detail::make_alias_table_layout(duplicates).ok, "");
+}
+
+int main(int argc, char* argv[]) {
+    test_layout();
+
+    const dll::fs::path alias_table_library = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(!alias_table_library.empty());
+
+    dll::shared_library lib(alias_table_library);
+    const dll::alias_table table(lib, "alias_table_library_table");
+    BOOST_TEST_EQ(table.size(), 8u);
+    BOOST_TEST(!table.empty());
+
+    std::size_t count = 0;
+    for (const dll::alias_table_entry& entry : table) {
+        ++count;
+        BOOST_TEST_EQ(entry.hash, dll::detail::name_hash(entry.name));
+        BOOST_TEST(table.find(entry.name) == entry.address);
+        BOOST_TEST(lib.has(entry.name));
+        BOOST_TEST(lib.get<void*>(entry.name) == entry.address);
+    }
+    BOOST_TEST_EQ(count, 8u);
+
+    BOOST_TEST_EQ(table.get<int(int)>("table_increment")(1), 2);
+    BOOST_TEST_EQ(table.get<int(int)>("table_decrement")(1), 0);
+    BOOST_TEST_EQ(table.get<int(int)>("table_twice")(3), 6);
+    BOOST_TEST_EQ(table.get<int(int)>("table_square")(3), 9);
+    BOOST_TEST_EQ(table.get<int(int)>(std::string("table_negate"))(3), -3);
+    BOOST_TEST_EQ(table.get<std::size_t(const std::vector<int>&)>("table_size")(std::vector<int>(5)), 5u);
+    BOOST_TEST_EQ(table.get<std::string>("table_name"), "alias_table_library");
+    BOOST_TEST_EQ(&table.get<int>("table_counter"), &lib.get_alias<int>("table_counter"));
+    BOOST_TEST_EQ(&table.get<int(int)>("table_increment"), &lib.get_alias<int(int)>("table_increment"));
+
+    BOOST_TEST(table.has("table_counter"));
+    BOOST_TEST(!table.has("table_missing"));
+    BOOST_TEST(!table.has(""));
+    BOOST_TEST(!table.find(std::string("table_")));
+    BOOST_TEST_THROWS(table.get<int>("table_missing"), dll::fs::system_error);
+
+    std::error_code ec;
+    dll::alias_table missing(lib, "no_such_table", ec);
+    BOOST_TEST(ec);
+    BOOST_TEST(missing.empty());
+    BOOST_TEST(!missing.find("table_counter"));
+    BOOST_TEST(missing.begin() == missing.end());
+    BOOST_TEST_THROWS(dll::alias_table(lib, "no_such_table"), dll::fs::system_error);
+
+    return boost::report_errors();
+}
@@ -12,6 +12,7 @@
 
 #include <boost/dll/smart_library.hpp>
 #include <boost/dll/import_mangled.hpp>
+#include <boost/dll/import_class.hpp>
 
 #include <boost/core/lightweight_test.hpp>
 #include <boost/filesystem.hpp>
@@ -71,6 +72,103 @@ int main(int argc, char* argv[])
     BOOST_TEST(func(ovv, 10,2) == 8 );
     BOOST_TEST(func(ovcv, 9,2) == 4.5 );
 
+    const smart_library& csm = sm;
+    auto size_of_class = import_mangled<std::size_t>(sm, "some_space::size_of_some_class");
+    auto cl = import_class<override_class, int>(csm, "some_space::some_class", *size_of_class, 42);
+
+    auto set = cl.bind<void(int)>("set");
+    auto get = cl.bind<const override_class, int()>("get");
+    for (int i = 0; i < 10; ++i) {
+        set(i);
+        BOOST_TEST_EQ(get(), i);
+    }
+
+    bool missing_thrown = false;
+    try {
+        cl.bind<void(int)>("no_such_function");
+    } catch (const boost::dll::fs::system_error&) {
+        missing_thrown = true;
+    }
+    BOOST_TEST(missing_thrown);
+
+    {
+        // Constructor, destructor and type info are resolved by the first import only, copies of the library share them
+        const std::size_t initially_cached = csm.symbol_storage().cache_size();
+        std::allocator<char> alloc;
+        auto first = import_class<override_class, int>(csm, std::allocator_arg, alloc, *size_of_class, 1);
+        const bool copy_constructible = first.is_copy_constructible();
+        const std::size_t cached = csm.symbol_storage().cache_size();
+        BOOST_TEST_GT(cached, initially_cached);
+
+        auto second = import_class<override_class, int>(csm, std::allocator_arg, alloc, *size_of_class, 2);
+        BOOST_TEST_EQ(second.is_copy_constructible(), copy_constructible);
+        BOOST_TEST_EQ(csm.symbol_storage().cache_size(), cached);
+        BOOST_TEST(&first.get_type_info() == &second.get_type_info());
+        BOOST_TEST(&second.get_type_info() == &csm.get_type_info<override_class>());
+        BOOST_TEST_EQ(csm.symbol_storage().cache_size(), cached);
+    }
+
+    imported_class_pool pool;
+    const override_class* first_address = nullptr;
+    for (int i = 0; i < 100; ++i) {
+        auto pooled = import_class<override_class, int>(sm, std::allocator_arg, pool, *size_of_class, i);
+        BOOST_TEST_EQ((pooled.call<const override_class, int()>("get")()), 456);
+        if (!first_address) {
+            first_address = pooled.get();
+        }
+        BOOST_TEST_EQ(pooled.get(), first_address); // memory is reused
+    }
+
+    {
+        auto pooled = import_class<override_class>(sm, std::allocator_arg, pool, *size_of_class);
+        BOOST_TEST_EQ((pooled.call<const override_class, int()>("get")()), 123);
+    }
+
+    std::allocator<char> std_alloc;
+    auto std_allocated = import_class<override_class, int>(csm, std::allocator_arg, std_alloc, *size_of_class, 7);
+    BOOST_TEST_EQ((std_allocated.call<const override_class, int()>("get")()), 456);
+
+    auto arr = import_class_array<override_class, int>(csm, *size_of_class, 50, 1);
+    BOOST_TEST_EQ(arr.size(), 50u);
+    BOOST_TEST_EQ(arr.stride(), *size_of_class);
+    BOOST_TEST_EQ(reinterpret_cast<const char*>(&arr[1]) - reinterpret_cast<const char*>(&arr[0]),
+        static_cast<std::ptrdiff_t>(*size_of_class));
+
+    auto arr_set = arr.get_mem_fn<void(int)>("set");
+    auto arr_get = arr.get_mem_fn<const override_class, int()>("get");
+    int value = 0;
+    for (auto& obj : arr) {
+        (obj.*arr_set)(value++);
+    }
+    BOOST_TEST_EQ(value, 50);
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        BOOST_TEST_EQ((arr[i].*arr_get)(), static_cast<int>(i));
+    }
+
+    auto moved_arr = std::move(arr);
+    BOOST_TEST(arr.empty());
+    BOOST_TEST_EQ(moved_arr.size(), 50u);
+
+    imported_vtable<override_class> vtable(sm);
+    BOOST_TEST(std::string(vtable.get_type_info().name()).find("some_class") != std::string::npos);
+
+    auto virtual_mul = vtable.get<double(double, double)>("func");
+    auto virtual_add = vtable.get<int(int, int)>("func");
+    BOOST_TEST(virtual_mul.index() != virtual_add.index());
+    BOOST_TEST_EQ(virtual_mul(cl.get(), 3., 2.), 6.);
+    BOOST_TEST_EQ(virtual_add(cl.get(), 1, 2), 3);
+    for (auto& obj : moved_arr) {
+        BOOST_TEST_EQ(virtual_add(&obj, 40, 2), 42);
+    }
+
+    bool not_virtual_thrown = false;
+    try {
+        vtable.get<void(int)>("set");
+    } catch (const boost::dll::fs::system_error&) {
+        not_virtual_thrown = true;
+    }
+    BOOST_TEST(not_virtual_thrown);
+
     return boost::report_errors();
 }
 
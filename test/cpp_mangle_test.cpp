@@ -20,6 +20,9 @@
 
 struct override_class {};
 
+struct mem_fn_int    { typedef override_class class_type;                typedef int(func_type)(int, int);          };
+struct mem_fn_double { typedef const volatile override_class class_type; typedef double(func_type)(double, double); };
+
 
 int main(int argc, char* argv[])
 {
@@ -82,8 +85,16 @@ int main(int argc, char* argv[])
 
 
 
+    // Rendered names are cached, the cache must be dropped when an alias is added
+    BOOST_TEST((ms.get_mem_fn<override_class, int(int, int)>("func").empty()));
+    BOOST_TEST(ms.get_constructor<override_class(int)>().empty());
+
     ms.add_alias<override_class>("some_space::some_class");
 
+    BOOST_TEST((!ms.get_mem_fn<override_class, int(int, int)>("func").empty()));
+    BOOST_TEST_EQ((ms.get_mem_fn<override_class, int(int, int)>("func")),
+                  (mangled_storage(ms).get_mem_fn<override_class, int(int, int)>("func")));
+
     auto ctor1 = ms.get_constructor<override_class()>();
     BOOST_TEST(!ctor1.empty());
 
@@ -97,6 +108,20 @@ int main(int argc, char* argv[])
     v = ms.get_mem_fn<override_class, int(int, int)>("func");
     BOOST_TEST(!v.empty());
 
+    auto overloads = ms.get_functions<void(int), void(double), void(char)>("overloaded");
+    BOOST_TEST_EQ(overloads.size(), 3u);
+    BOOST_TEST_EQ(overloads[0], ms.get_function<void(int)>("overloaded"));
+    BOOST_TEST_EQ(overloads[1], ms.get_function<void(double)>("overloaded"));
+    BOOST_TEST(!overloads[0].empty());
+    BOOST_TEST(!overloads[1].empty());
+    BOOST_TEST(overloads[2].empty());
+
+    auto mem_overloads = ms.get_mem_fns<mem_fn_int, mem_fn_double>("func");
+    BOOST_TEST_EQ(mem_overloads.size(), 2u);
+    BOOST_TEST_EQ(mem_overloads[0], v);
+    BOOST_TEST_EQ(mem_overloads[1], (ms.get_mem_fn<const volatile override_class, double(double, double)>("func")));
+    BOOST_TEST(!mem_overloads[1].empty());
+
 
     auto dtor = ms.get_destructor<override_class>();
 
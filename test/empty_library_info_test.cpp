@@ -35,6 +35,7 @@ int main(int argc, char* argv[])
     BOOST_TEST(empty.empty());
 
     BOOST_TEST(lib_info.symbols("section_that_does_not_exist").empty());
+    BOOST_TEST(!lib_info.build_id().bytes.empty());
 
     return boost::report_errors();
 }
@@ -0,0 +1,180 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/hot_reload.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+using factory_t = std::size_t(const std::vector<int>&);
+
+// Trailing data does not prevent loading, but changes the size of the file
+static void touch(const dll::fs::path& p) {
+    std::ofstream ofs(p.string().c_str(), std::ios_base::binary | std::ios_base::app);
+    ofs << '\0';
+}
+
+int main(int argc, char* argv[]) {
+    const dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    const dll::fs::path plugin_path = dll::fs::path(argv[0]).string() + ".hot_reload_plugin";
+    dll::fs::copy_file(shared_library_path, plugin_path, dll::fs::copy_options::overwrite_existing);
+
+    const std::vector<int> v(3, 0);
+    {
+        dll::hot_reload_plugin plugin(plugin_path, dll::load_mode::default_mode, dll::fs::path(argv[0]).parent_path());
+        BOOST_TEST_EQ(plugin.generation(), 1u);
+        BOOST_TEST_EQ(plugin.loaded_generations(), 1u);
+        BOOST_TEST(plugin.location() == plugin_path);
+
+        const dll::reloadable_alias<factory_t> foo_bar = plugin.alias<factory_t>("foo_bar");
+        BOOST_TEST_EQ(foo_bar(v), 3u);
+        BOOST_TEST_EQ(plugin.generation(), 1u);
+        BOOST_TEST_EQ(plugin.loaded_generations(), 1u);
+
+        bool thrown = false;
+        try {
+            plugin.alias<factory_t>("alias_that_does_not_exist");
+        } catch (const dll::fs::system_error&) {
+            thrown = true;
+        }
+        BOOST_TEST(thrown);
+        BOOST_TEST_EQ(foo_bar(v), 3u);
+
+        // Generation is a copy of the plugin
+        {
+            const dll::hot_reload_plugin::pinned pinned = plugin.pin();
+            BOOST_TEST_EQ(pinned.generation(), 1u);
+            BOOST_TEST(pinned.library().location() != dll::fs::canonical(plugin_path));
+        }
+
+        // Unchanged file is not reloaded
+        std::error_code ec;
+        BOOST_TEST(!plugin.reload_if_changed(ec));
+        BOOST_TEST(!ec);
+
+        touch(plugin_path);
+        BOOST_TEST(plugin.reload_if_changed(ec));
+        BOOST_TEST(!ec);
+        BOOST_TEST_EQ(plugin.generation(), 2u);
+        BOOST_TEST_EQ(plugin.loaded_generations(), 1u);
+        BOOST_TEST_EQ(foo_bar(v), 3u);
+
+        // Pinned generation is not unloaded
+        {
+            dll::hot_reload_plugin::pinned pinned = plugin.pin();
+            plugin.reload();
+            BOOST_TEST_EQ(plugin.generation(), 3u);
+            BOOST_TEST_EQ(pinned.generation(), 2u);
+            BOOST_TEST_EQ(plugin.reclaim(), 0u);
+            BOOST_TEST_EQ(plugin.loaded_generations(), 2u);
+
+            const dll::hot_reload_plugin::pinned moved = std::move(pinned);
+            BOOST_TEST_EQ(moved.generation(), 2u);
+            BOOST_TEST(moved.library().has("foo_bar"));
+            BOOST_TEST_EQ(plugin.pin().generation(), 3u);
+        }
+        BOOST_TEST_EQ(plugin.reclaim(), 1u);
+        BOOST_TEST_EQ(plugin.loaded_generations(), 1u);
+
+        // Failed reload keeps the current generation
+        dll::fs::remove(plugin_path);
+        BOOST_TEST(!plugin.reload(ec));
+        BOOST_TEST(ec);
+        BOOST_TEST_EQ(plugin.generation(), 3u);
+        BOOST_TEST_EQ(foo_bar(v), 3u);
+        dll::fs::copy_file(shared_library_path, plugin_path, dll::fs::copy_options::overwrite_existing);
+
+        // Concurrent calls during reloads
+        std::atomic<bool> stop(false);
+        std::atomic<std::size_t> failures(0);
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 4; ++i) {
+            readers.emplace_back([&]() {
+                while (!stop.load()) {
+                    if (foo_bar(v) != 3u) {
+                        ++failures;
+                    }
+                }
+            });
+        }
+        for (int i = 0; i < 20; ++i) {
+            plugin.reload();
+        }
+        stop = true;
+        for (std::size_t i = 0; i < readers.size(); ++i) {
+            readers[i].join();
+        }
+        BOOST_TEST_EQ(failures.load(), 0u);
+        BOOST_TEST_EQ(plugin.generation(), 23u);
+        plugin.reclaim();
+        BOOST_TEST_EQ(plugin.loaded_generations(), 1u);
+
+        // Watcher
+        {
+            dll::plugin_watcher watcher(std::chrono::milliseconds(50));
+            watcher.watch(plugin);
+            touch(plugin_path);
+
+            for (int i = 0; i < 500 && plugin.generation() == 23u; ++i) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            BOOST_TEST_EQ(plugin.generation(), 24u);
+            BOOST_TEST_EQ(foo_bar(v), 3u);
+
+            watcher.unwatch(plugin);
+            BOOST_TEST_EQ(watcher.poll(), 0u);
+        }
+    }
+
+#if BOOST_OS_LINUX
+    // Directory stays watched until its last user is removed
+    {
+        const dll::fs::path directory = plugin_path.parent_path().empty() ? dll::fs::path(".") : plugin_path.parent_path();
+        dll::detail::file_change_notifier notifier;
+        const int wd = notifier.add_directory(directory);
+        BOOST_TEST(wd >= 0);
+        BOOST_TEST_EQ(notifier.add_directory(directory), wd);
+
+        notifier.remove_directory(wd);
+        touch(plugin_path);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        notifier.wait(std::chrono::milliseconds(5000));
+        BOOST_TEST(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(5000));
+
+        notifier.remove_directory(wd);
+        notifier.wait(std::chrono::milliseconds(0)); // IN_IGNORED event of the removed watch
+        touch(plugin_path);
+        start = std::chrono::steady_clock::now();
+        notifier.wait(std::chrono::milliseconds(200));
+        BOOST_TEST(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(200));
+    }
+#endif
+
+    dll::fs::remove(plugin_path);
+
+    bool thrown = false;
+    try {
+        dll::hot_reload_plugin missing(plugin_path);
+    } catch (const dll::fs::system_error&) {
+        thrown = true;
+    }
+    BOOST_TEST(thrown);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,105 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/lazy_plugin.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <thread>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+int main(int argc, char* argv[]) {
+    const dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    const dll::lazy_plugin plugin(shared_library_path);
+    BOOST_TEST(!plugin.is_loaded());
+    BOOST_TEST(plugin.location() == shared_library_path);
+
+    const std::vector<std::string>& aliases = plugin.aliases();
+    BOOST_TEST(std::is_sorted(aliases.begin(), aliases.end()));
+    BOOST_TEST(plugin.has_alias("foo_bar"));
+    BOOST_TEST(plugin.has_alias(std::string("info")));
+    BOOST_TEST(!plugin.has_alias("alias_that_does_not_exist"));
+
+    dll::library_info info(shared_library_path);
+    BOOST_TEST(plugin.build_id() == info.build_id());
+    BOOST_TEST(!plugin.is_loaded());
+
+    // Copies share the plugin
+    const dll::lazy_plugin copy = plugin;
+    const dll::lazy_alias<std::size_t(const std::vector<int>&)> foo_bar
+        = copy.alias<std::size_t(const std::vector<int>&)>("foo_bar");
+    BOOST_TEST(!plugin.is_loaded());
+
+    const std::vector<int> v(3, 0);
+    std::vector<std::thread> threads;
+    std::vector<std::size_t> results(8, 0);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&foo_bar, &v, &results, i]() {
+            results[i] = foo_bar(v);
+        });
+    }
+    for (std::size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+    BOOST_TEST_EQ(std::count(results.begin(), results.end(), 3u), 8);
+    BOOST_TEST(plugin.is_loaded());
+    BOOST_TEST(copy.is_loaded());
+    BOOST_TEST_EQ(&plugin.library(), &copy.library());
+    BOOST_TEST(plugin.library().location() == dll::shared_library(shared_library_path).location());
+
+    const dll::lazy_alias<std::size_t(const std::vector<int>&)> foo_bar_copy = foo_bar;
+    BOOST_TEST_EQ(foo_bar_copy(v), 3u);
+
+    auto info_alias = plugin.get_alias<std::string>("info");
+    BOOST_TEST(info_alias->find("test_library") != std::string::npos);
+
+    bool thrown = false;
+    try {
+        plugin.get_alias<int>(std::string("alias_that_does_not_exist"));
+    } catch (const dll::fs::system_error&) {
+        thrown = true;
+    }
+    BOOST_TEST(thrown);
+
+    // Error on load is reported on each use
+    const dll::fs::path copied_path = dll::fs::path(argv[0]).string() + ".lazy_plugin_copy";
+    dll::fs::copy_file(shared_library_path, copied_path, dll::fs::copy_options::overwrite_existing);
+    const dll::lazy_plugin removed(copied_path);
+    dll::fs::remove(copied_path);
+    BOOST_TEST(removed.has_alias("foo_bar"));
+
+    const dll::lazy_alias<std::size_t(const std::vector<int>&)> removed_foo_bar
+        = removed.alias<std::size_t(const std::vector<int>&)>("foo_bar");
+    for (int i = 0; i < 2; ++i) {
+        thrown = false;
+        try {
+            removed_foo_bar(v);
+        } catch (const dll::fs::system_error&) {
+            thrown = true;
+        }
+        BOOST_TEST(thrown);
+        BOOST_TEST(!removed.is_loaded());
+    }
+
+    thrown = false;
+    try {
+        dll::lazy_plugin not_a_binary(dll::fs::path(argv[0]).string() + ".file_that_does_not_exist");
+    } catch (const std::exception&) {
+        thrown = true;
+    }
+    BOOST_TEST(thrown);
+
+    return boost::report_errors();
+}
@@ -17,6 +17,7 @@
 
 // Unit Tests
 
+#include <fstream>
 #include <iterator>
 
 int main(int argc, char* argv[])
@@ -40,6 +41,41 @@ int main(int argc, char* argv[])
     BOOST_TEST(std::find(symb.begin(), symb.end(), "protected_function") != symb.end());
 #endif
 
+    // Overloads that fill the provided containers replace their content
+    std::vector<std::string> filled(3, "stale");
+    lib_info.sections(filled);
+    BOOST_TEST(filled == sec);
+    lib_info.symbols(filled);
+    BOOST_TEST(filled == symb);
+
+    for (std::size_t i = 0; i < symb.size(); ++i) {
+        BOOST_TEST(lib_info.has_symbol(symb[i]));
+    }
+    BOOST_TEST(lib_info.has_symbol("say_hello"));
+    BOOST_TEST(!lib_info.has_symbol("symbol_that_does_not_exist"));
+    BOOST_TEST(!lib_info.has_symbol(""));
+
+    std::vector<boost::dll::symbol_info> symb_info = lib_info.symbols_info();
+    BOOST_TEST_EQ(symb_info.size(), symb.size());
+    for (std::size_t i = 0; i < symb_info.size() && i < symb.size(); ++i) {
+        BOOST_TEST_EQ(symb_info[i].name, symb[i]);
+        BOOST_TEST(symb_info[i].binding != boost::dll::symbol_binding::local);
+    }
+    for (std::size_t i = 0; i < symb_info.size(); ++i) {
+        if (symb_info[i].name == "say_hello") {
+            BOOST_TEST(symb_info[i].type == boost::dll::symbol_type::function);
+            BOOST_TEST(symb_info[i].address != 0);
+            BOOST_TEST(symb_info[i].section_index != 0);
+        } else if (symb_info[i].name == "const_integer_g") {
+            BOOST_TEST(symb_info[i].type == boost::dll::symbol_type::object);
+#if defined(__ELF__)
+            BOOST_TEST_EQ(symb_info[i].size, sizeof(int));
+#endif
+        }
+        BOOST_TEST(symb_info[i].version.empty());
+        BOOST_TEST(symb_info[i].default_version);
+    }
+
     std::cout << "\n\n'boostdll' symbols:\n";
     symb = lib_info.symbols("boostdll");
     std::copy(symb.begin(), symb.end(), std::ostream_iterator<std::string>(std::cout, "\n"));
@@ -55,6 +91,41 @@ int main(int argc, char* argv[])
 
     BOOST_TEST(lib_info.symbols("section_that_does_not_exist").empty());
 
+    boost::dll::section_view sec_data = lib_info.section_data("boostdll");
+    BOOST_TEST(!sec_data.empty());
+    BOOST_TEST(sec_data.data() != nullptr);
+    BOOST_TEST(sec_data.file_offset() != 0);
+    BOOST_TEST_EQ(sec_data.end() - sec_data.begin(), static_cast<std::ptrdiff_t>(sec_data.size()));
+    {
+        std::ifstream raw(shared_library_path.string().c_str(), std::ios_base::binary);
+        std::vector<char> raw_data(sec_data.size());
+        raw.seekg(static_cast<std::streamoff>(sec_data.file_offset()));
+        raw.read(&raw_data[0], static_cast<std::streamsize>(raw_data.size()));
+        BOOST_TEST(std::equal(raw_data.begin(), raw_data.end(), sec_data.begin()));
+    }
+    const boost::dll::section_view sec_data_copy = sec_data;
+    BOOST_TEST_EQ(sec_data_copy.data(), sec_data.data());
+    BOOST_TEST(lib_info.section_data(std::string("boostdll")).size() == sec_data.size());
+
+    const boost::dll::binary_id id = lib_info.build_id();
+    std::cout << "\n\nBuild id: " << id.to_string() << '\n';
+    BOOST_TEST(!id.bytes.empty());
+    BOOST_TEST_EQ(id.to_string().size(), id.bytes.size() * 2);
+    BOOST_TEST(id == lib_info.build_id());
+    BOOST_TEST(id != boost::dll::library_info(argv[0]).build_id());
+    const boost::dll::section_view build_id_note = lib_info.section_data(".note.gnu.build-id");
+    if (!build_id_note.empty()) {
+        BOOST_TEST(id.source == boost::dll::binary_id::source_type::gnu_build_id);
+        BOOST_TEST(id.bytes.size() < build_id_note.size());
+        BOOST_TEST(std::equal(id.bytes.begin(), id.bytes.end(), reinterpret_cast<const unsigned char*>(build_id_note.end()) - id.bytes.size()));
+    }
+
+    BOOST_TEST(lib_info.section_data("section_that_does_not_exist").empty());
+    BOOST_TEST(!lib_info.section_data("section_that_does_not_exist").data());
+#if defined(__ELF__)
+    BOOST_TEST(lib_info.section_data(".bss").empty());
+#endif
+
     // Self testing
     std::cout << "Self: " << argv[0];
     boost::dll::library_info self_info(argv[0]);
@@ -76,5 +147,25 @@ int main(int argc, char* argv[])
         BOOST_TEST(!symb.empty());
     }
 
+    boost::dll::fs::path versioned_path = "/lib/x86_64-linux-gnu/libc.so.6";
+    if (exists(versioned_path)) {
+        boost::dll::library_info versioned_lib(versioned_path);
+        symb_info = versioned_lib.symbols_info();
+        std::size_t default_versions = 0;
+        std::size_t hidden_versions = 0;
+        for (std::size_t i = 0; i < symb_info.size(); ++i) {
+            BOOST_TEST(symb_info[i].name.find('@') == std::string::npos);
+            if (symb_info[i].name == "memcpy" && symb_info[i].default_version) {
+                BOOST_TEST(symb_info[i].version.find("GLIBC_") == 0);
+                BOOST_TEST(symb_info[i].type == boost::dll::symbol_type::indirect_function);
+            }
+            if (!symb_info[i].version.empty()) {
+                ++(symb_info[i].default_version ? default_versions : hidden_versions);
+            }
+        }
+        BOOST_TEST(default_versions > 0);
+        BOOST_TEST(hidden_versions > 0);
+    }
+
     return boost::report_errors();
 }
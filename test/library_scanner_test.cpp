@@ -0,0 +1,123 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/library_scanner.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+int main(int argc, char* argv[]) {
+    const dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    const dll::fs::path not_a_binary = dll::fs::path(argv[0]).string() + ".scanner.txt";
+    {
+        std::ofstream ofs(not_a_binary.string().c_str());
+        ofs << "This is not a binary file, but it is long enough to read the headers from it. "
+            << "This is not a binary file, but it is long enough to read the headers from it. "
+            << "This is not a binary file, but it is long enough to read the headers from it.";
+    }
+
+    std::vector<dll::fs::path> paths;
+    for (int i = 0; i < 8; ++i) {
+        paths.push_back(shared_library_path);
+        paths.push_back(argv[0]);
+    }
+    paths.push_back(not_a_binary);
+    paths.push_back("/path/that/does/not/exist");
+
+    for (std::size_t threads = 0; threads < 5; ++threads) {
+        std::size_t libs_count = 0;
+        std::size_t self_count = 0;
+        std::size_t errors_count = 0;
+        std::set<dll::fs::path> seen;
+
+        dll::scan_libraries(paths, [&](const dll::scanned_library& res) {
+            seen.insert(res.path);
+            if (res.error) {
+                ++errors_count;
+                BOOST_TEST(res.sections.empty());
+                BOOST_TEST(res.symbols.empty());
+                BOOST_TEST_THROWS(std::rethrow_exception(res.error), std::exception);
+                return;
+            }
+
+            BOOST_TEST(!res.sections.empty());
+            if (res.path == shared_library_path) {
+                ++libs_count;
+                BOOST_TEST(std::find(res.sections.begin(), res.sections.end(), "boostdll") != res.sections.end());
+                BOOST_TEST(std::find(res.symbols.begin(), res.symbols.end(), "say_hello") != res.symbols.end());
+            } else {
+                ++self_count;
+            }
+
+#if defined(__ELF__)
+            BOOST_TEST(
+                res.format == dll::library_info::binary_format::elf32
+                || res.format == dll::library_info::binary_format::elf64
+            );
+#endif
+        }, threads);
+
+        BOOST_TEST_EQ(libs_count, 8u);
+        BOOST_TEST_EQ(self_count, 8u);
+        BOOST_TEST_EQ(errors_count, 2u);
+        BOOST_TEST_EQ(seen.size(), 4u);
+    }
+
+    {
+        dll::library_info info(shared_library_path);
+        std::size_t calls = 0;
+        dll::scan_libraries(std::vector<dll::fs::path>(1, shared_library_path), [&](const dll::scanned_library& res) {
+            ++calls;
+            BOOST_TEST(!res.error);
+            BOOST_TEST(res.format == info.format());
+            BOOST_TEST(res.sections == info.sections());
+            BOOST_TEST(res.symbols == info.symbols());
+        });
+        BOOST_TEST_EQ(calls, 1u);
+    }
+
+    // Exception from callback stops the scanning and is rethrown
+    {
+        std::size_t calls = 0;
+        BOOST_TEST_THROWS(
+            dll::scan_libraries(paths, [&](const dll::scanned_library&) {
+                ++calls;
+                throw std::logic_error("stop");
+            }, 2),
+            std::logic_error
+        );
+        BOOST_TEST_EQ(calls, 1u);
+    }
+
+    // Directory scanning
+    {
+        std::size_t found = 0;
+        dll::scan_libraries(shared_library_path.parent_path(), [&](const dll::scanned_library& res) {
+            if (res.path.filename() == shared_library_path.filename()) {
+                ++found;
+                BOOST_TEST(!res.error);
+            }
+        });
+        BOOST_TEST_EQ(found, 1u);
+    }
+
+    dll::fs::remove(not_a_binary);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,106 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/loaded_library_info.hpp>
+#include <boost/dll/library_info.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/predef/os.h>
+
+#include <algorithm>
+#include <cstring>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+static bool contains(const std::vector<std::string>& v, const char* value) {
+    return std::find(v.begin(), v.end(), value) != v.end();
+}
+
+int main(int argc, char* argv[]) {
+    boost::dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    dll::shared_library lib(shared_library_path);
+    const dll::loaded_library_info info(lib);
+    dll::library_info file_info(shared_library_path);
+
+    const std::vector<std::string> symbols = info.symbols();
+    BOOST_TEST(!symbols.empty());
+    BOOST_TEST(contains(symbols, "foo_bar"));
+    BOOST_TEST(contains(symbols, "info"));
+
+    const std::vector<std::string> file_symbols = file_info.symbols();
+    for (std::size_t i = 0; i < symbols.size(); ++i) {
+        BOOST_TEST(contains(file_symbols, symbols[i].c_str()));
+    }
+
+    std::vector<std::string> boostdll_symbols = info.symbols("boostdll");
+    BOOST_TEST(contains(boostdll_symbols, "foo_bar"));
+    BOOST_TEST(contains(boostdll_symbols, "info"));
+    BOOST_TEST(!contains(boostdll_symbols, "const_integer_g"));
+    BOOST_TEST(info.symbols(std::string("boostdll")) == boostdll_symbols);
+
+    std::vector<std::string> file_boostdll_symbols = file_info.symbols("boostdll");
+    std::sort(boostdll_symbols.begin(), boostdll_symbols.end());
+    std::sort(file_boostdll_symbols.begin(), file_boostdll_symbols.end());
+    BOOST_TEST(boostdll_symbols == file_boostdll_symbols);
+
+    BOOST_TEST(info.symbols("section_that_does_not_exist").empty());
+
+    const std::vector<std::string> sections = info.sections();
+    BOOST_TEST(contains(sections, "boostdll"));
+
+    const dll::loaded_section boostdll = info.section("boostdll");
+    BOOST_TEST(!boostdll.empty());
+    BOOST_TEST(boostdll.data);
+    BOOST_TEST_EQ(boostdll.size, file_info.section_data("boostdll").size());
+    BOOST_TEST(boostdll.end() == boostdll.begin() + boostdll.size);
+
+    // Alias points to the symbol, alias itself is located in the section
+    const void* const alias_address = lib.get<void*>("foo_bar");
+    BOOST_TEST(reinterpret_cast<const char*>(&lib.get<void*>("foo_bar")) >= boostdll.begin());
+    BOOST_TEST(reinterpret_cast<const char*>(&lib.get<void*>("foo_bar")) < boostdll.end());
+    BOOST_TEST(alias_address);
+
+#if !BOOST_OS_WINDOWS && !BOOST_OS_MACOS && !BOOST_OS_IOS
+    // Read only content is not relocated, so it is the same in file and in memory
+    const dll::loaded_section note = info.section(".note.gnu.build-id");
+    const dll::section_view file_note = file_info.section_data(".note.gnu.build-id");
+    BOOST_TEST_EQ(note.size, file_note.size());
+    if (note.size && note.size == file_note.size()) {
+        BOOST_TEST(!std::memcmp(note.data, file_note.data(), note.size));
+    }
+#endif
+
+    BOOST_TEST(info.section("section_that_does_not_exist").empty());
+    BOOST_TEST(!info.section(std::string("section_that_does_not_exist")).data);
+
+    std::error_code ec;
+    dll::shared_library not_loaded;
+    dll::loaded_library_info not_loaded_info(not_loaded, ec);
+    BOOST_TEST(ec);
+
+    // Error from the previous call must not survive the successful construction
+    ec = std::make_error_code(std::errc::bad_file_descriptor);
+    const dll::loaded_library_info info_with_ec(lib, ec);
+    BOOST_TEST(!ec);
+    BOOST_TEST(contains(info_with_ec.symbols(), "foo_bar"));
+
+    bool thrown = false;
+    try {
+        dll::loaded_library_info throwing(not_loaded);
+    } catch (const boost::dll::fs::system_error&) {
+        thrown = true;
+    }
+    BOOST_TEST(thrown);
+
+    return boost::report_errors();
+}
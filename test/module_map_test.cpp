@@ -0,0 +1,120 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/module_map.hpp>
+#include <boost/dll/runtime_symbol_info.hpp>
+#include <boost/dll/shared_library.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+int main(int argc, char* argv[]) {
+    const dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    dll::module_map map;
+    BOOST_TEST(map.size() > 0);
+    BOOST_TEST(!map.find(nullptr));
+    BOOST_TEST(!map.find_cached(nullptr));
+
+    const dll::module_map::loaded_module self = map.find_symbol(main);
+    BOOST_TEST(self);
+    BOOST_TEST(self == map.find_cached(reinterpret_cast<const void*>(&main)));
+    BOOST_TEST(dll::fs::equivalent(self.path(), dll::program_location()));
+    BOOST_TEST(self.base_address() <= reinterpret_cast<std::uintptr_t>(&main));
+
+    dll::shared_library lib(shared_library_path);
+    const int* const integer = &lib.get<const int>("const_integer_g");
+
+    const dll::module_map::loaded_module plugin = map.find(integer);
+    BOOST_TEST(plugin);
+    BOOST_TEST(plugin != self);
+    BOOST_TEST(plugin.id() != self.id());
+    BOOST_TEST(dll::fs::equivalent(plugin.path(), shared_library_path));
+    BOOST_TEST(dll::fs::equivalent(plugin.path(), dll::symbol_location_ptr(integer)));
+    BOOST_TEST(plugin == map.find_cached(integer));
+    BOOST_TEST(!map.refresh());
+
+    // Concurrent lookups while the map is refreshed
+    {
+        std::atomic<bool> stop(false);
+        std::atomic<std::size_t> failures(0);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&]() {
+                while (!stop.load()) {
+                    if (map.find_cached(integer) != plugin || map.find_cached(reinterpret_cast<const void*>(&main)) != self) {
+                        ++failures;
+                    }
+                }
+            });
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            map.refresh();
+        }
+        stop = true;
+        for (std::size_t i = 0; i < threads.size(); ++i) {
+            threads[i].join();
+        }
+        BOOST_TEST_EQ(failures.load(), 0u);
+    }
+
+    const std::uintptr_t plugin_address = reinterpret_cast<std::uintptr_t>(integer);
+    lib.unload();
+
+    // Handle stays valid after unload
+    BOOST_TEST(dll::fs::equivalent(plugin.path(), shared_library_path));
+    if (map.refresh()) {
+        // Library could stay loaded, for example because of the STB_GNU_UNIQUE symbols
+        BOOST_TEST(map.find_cached(reinterpret_cast<const void*>(plugin_address)) != plugin);
+    }
+
+    lib.load(shared_library_path);
+    const dll::module_map::loaded_module reloaded = map.find(&lib.get<const int>("const_integer_g"));
+    BOOST_TEST(reloaded);
+    BOOST_TEST(dll::fs::equivalent(reloaded.path(), shared_library_path));
+
+    // Concurrent lookups while the snapshots are replaced and reused by the load and unload cycles
+    {
+        std::atomic<bool> stop(false);
+        std::atomic<std::size_t> failures(0);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&]() {
+                while (!stop.load()) {
+                    if (map.find_cached(reinterpret_cast<const void*>(&main)) != self) {
+                        ++failures;
+                    }
+                }
+            });
+        }
+
+        for (int i = 0; i < 50; ++i) {
+            lib.unload();
+            map.refresh();
+            lib.load(shared_library_path);
+            BOOST_TEST(map.find(&lib.get<const int>("const_integer_g")));
+        }
+        stop = true;
+        for (std::size_t i = 0; i < threads.size(); ++i) {
+            threads[i].join();
+        }
+        BOOST_TEST_EQ(failures.load(), 0u);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,135 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/plugin_cache.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <thread>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+using factory_t = std::size_t(const std::vector<int>&);
+
+int main(int argc, char* argv[]) {
+    const dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    const std::vector<int> v(3, 0);
+    const dll::plugin_cache::clock_type::duration timeout = std::chrono::seconds(10);
+
+    {
+        dll::plugin_cache cache(timeout);
+        BOOST_TEST_EQ(cache.loaded_count(), 0u);
+
+        const dll::plugin_cache::clock_type::time_point start = dll::plugin_cache::clock_type::now();
+        {
+            auto foo_bar = cache.get_alias<factory_t>(shared_library_path, "foo_bar");
+            BOOST_TEST_EQ(foo_bar(v), 3u);
+            BOOST_TEST(cache.is_loaded(shared_library_path));
+            BOOST_TEST_EQ(cache.loaded_count(), 1u);
+            BOOST_TEST(cache.loaded_size() > 0u);
+
+            // Plugin is in use
+            BOOST_TEST_EQ(cache.trim(start + std::chrono::hours(1)), 0u);
+            BOOST_TEST_EQ(cache.unload_idle(), 0u);
+
+            auto copy = foo_bar;
+            BOOST_TEST_EQ(copy(v), 3u);
+
+            auto variable = cache.get_alias<std::size_t>(shared_library_path, std::string("foo_variable"));
+            BOOST_TEST_EQ(*variable, 42u);
+
+            auto integer = cache.get<const int>(shared_library_path, "const_integer_g");
+            BOOST_TEST_EQ(*integer, 777);
+            BOOST_TEST_EQ(cache.loaded_count(), 1u);
+        }
+
+        // Plugin is idle, but not for long enough
+        BOOST_TEST_EQ(cache.trim(dll::plugin_cache::clock_type::now()), 0u);
+        BOOST_TEST(cache.is_loaded(shared_library_path));
+
+        BOOST_TEST_EQ(cache.trim(dll::plugin_cache::clock_type::now() + std::chrono::hours(1)), 1u);
+        BOOST_TEST(!cache.is_loaded(shared_library_path));
+        BOOST_TEST_EQ(cache.loaded_count(), 0u);
+        BOOST_TEST_EQ(cache.loaded_size(), 0u);
+
+        // Transparent reload
+        BOOST_TEST_EQ(cache.get_alias<factory_t>(shared_library_path, std::string("foo_bar"))(v), 3u);
+        BOOST_TEST(cache.is_loaded(shared_library_path));
+        BOOST_TEST_EQ(cache.unload_idle(), 1u);
+
+        bool thrown = false;
+        try {
+            cache.get_alias<factory_t>(dll::fs::path(argv[0]).string() + ".file_that_does_not_exist", "foo_bar");
+        } catch (const dll::fs::system_error&) {
+            thrown = true;
+        }
+        BOOST_TEST(thrown);
+        BOOST_TEST_EQ(cache.loaded_count(), 0u);
+    }
+
+    // Size budget with LRU eviction. Different files of the same library are different plugins
+    const dll::fs::path copy1 = dll::fs::path(argv[0]).string() + ".plugin_cache_copy1";
+    const dll::fs::path copy2 = dll::fs::path(argv[0]).string() + ".plugin_cache_copy2";
+    dll::fs::copy_file(shared_library_path, copy1, dll::fs::copy_options::overwrite_existing);
+    dll::fs::copy_file(shared_library_path, copy2, dll::fs::copy_options::overwrite_existing);
+    {
+        const std::uintmax_t size = dll::fs::file_size(shared_library_path);
+        dll::plugin_cache cache(timeout, size * 2);
+
+        BOOST_TEST_EQ(cache.get_alias<factory_t>(shared_library_path, "foo_bar")(v), 3u);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        BOOST_TEST_EQ(cache.get_alias<factory_t>(copy1, "foo_bar")(v), 3u);
+        BOOST_TEST_EQ(cache.loaded_count(), 2u);
+
+        // Evicts the least recently used plugin
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        auto in_use = cache.get_alias<factory_t>(copy2, "foo_bar");
+        BOOST_TEST_EQ(cache.loaded_count(), 2u);
+        BOOST_TEST(!cache.is_loaded(shared_library_path));
+        BOOST_TEST(cache.is_loaded(copy1));
+        BOOST_TEST(cache.is_loaded(copy2));
+
+        // Plugins in use are not evicted even if the budget is exceeded
+        auto in_use2 = cache.get_alias<factory_t>(copy1, "foo_bar");
+        auto in_use3 = cache.get_alias<factory_t>(shared_library_path, "foo_bar");
+        BOOST_TEST_EQ(cache.loaded_count(), 3u);
+        BOOST_TEST_EQ(in_use(v) + in_use2(v) + in_use3(v), 9u);
+
+        // Lease outlives the cache
+        in_use = cache.get_alias<factory_t>(copy2, "foo_bar");
+    }
+
+    // Concurrent access
+    {
+        dll::plugin_cache cache(std::chrono::seconds(0));
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&cache, &shared_library_path, &v]() {
+                for (int j = 0; j < 100; ++j) {
+                    BOOST_TEST_EQ(cache.get_alias<factory_t>(shared_library_path, "foo_bar")(v), 3u);
+                    cache.trim();
+                }
+            });
+        }
+        for (std::size_t i = 0; i < threads.size(); ++i) {
+            threads[i].join();
+        }
+        cache.trim();
+        BOOST_TEST_EQ(cache.loaded_count(), 0u);
+    }
+
+    dll::fs::remove(copy1);
+    dll::fs::remove(copy2);
+
+    return boost::report_errors();
+}
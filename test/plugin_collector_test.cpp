@@ -0,0 +1,103 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/plugin_collector.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <fstream>
+#include <thread>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+using factory_t = std::size_t(const std::vector<int>&);
+
+int main(int argc, char* argv[]) {
+    const dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    const dll::fs::path not_a_binary = dll::fs::path(argv[0]).string() + ".collector.txt";
+    {
+        std::ofstream ofs(not_a_binary.string().c_str());
+        ofs << "This is not a binary file, but it is long enough to read the headers from it. "
+            << "This is not a binary file, but it is long enough to read the headers from it.";
+    }
+
+    std::vector<dll::fs::path> paths;
+    paths.push_back(argv[0]);   // binary without the factory
+    paths.push_back(not_a_binary);
+    paths.push_back(dll::fs::path(argv[0]).string() + ".file_that_does_not_exist");
+    for (int i = 0; i < 8; ++i) {
+        paths.push_back(shared_library_path);
+    }
+
+    dll::plugin_collector<factory_t> collector("foo_bar");
+    BOOST_TEST(collector.empty());
+    BOOST_TEST(!collector.has(shared_library_path));
+
+    BOOST_TEST_EQ(collector.collect(paths, 4), 1u);
+    BOOST_TEST_EQ(collector.size(), 1u);
+    BOOST_TEST(collector.has(shared_library_path));
+    BOOST_TEST(!collector.has(argv[0]));
+    BOOST_TEST(!collector.has(not_a_binary));
+
+    const std::vector<int> v(3, 0);
+    BOOST_TEST_EQ(collector.get(shared_library_path)(v), 3u);
+
+    // Already collected plugins are not loaded again
+    BOOST_TEST_EQ(collector.collect(paths, 1), 0u);
+    BOOST_TEST_EQ(collector.size(), 1u);
+
+    const dll::plugin_collector<factory_t>::map_type factories = collector.factories();
+    BOOST_TEST_EQ(factories.size(), 1u);
+    BOOST_TEST(factories.begin()->first == shared_library_path);
+    BOOST_TEST_EQ(factories.begin()->second(v), 3u);
+
+    bool thrown = false;
+    try {
+        collector.get(not_a_binary);
+    } catch (const dll::fs::system_error&) {
+        thrown = true;
+    }
+    BOOST_TEST(thrown);
+
+    // Queries from other threads during collection
+    dll::plugin_collector<factory_t> concurrent("foo_bar");
+    std::thread reader([&concurrent, &shared_library_path]() {
+        while (!concurrent.has(shared_library_path)) {
+            std::this_thread::yield();
+        }
+    });
+    BOOST_TEST_EQ(concurrent.collect(paths), 1u);
+    reader.join();
+
+    // Directory scan
+    dll::plugin_collector<factory_t> from_directory("foo_bar");
+    from_directory.collect(shared_library_path.parent_path());
+    BOOST_TEST(!from_directory.empty());
+    const dll::plugin_collector<factory_t>::map_type found = from_directory.factories();
+    for (dll::plugin_collector<factory_t>::map_type::const_iterator it = found.begin(); it != found.end(); ++it) {
+        BOOST_TEST_EQ(it->second(v), 3u);
+    }
+
+    // Factory keeps the library loaded
+    dll::plugin_collector<factory_t>::factory_type factory = collector.get(shared_library_path);
+    {
+        dll::plugin_collector<factory_t> tmp("foo_bar");
+        tmp.collect(paths);
+        factory = tmp.get(shared_library_path);
+    }
+    BOOST_TEST_EQ(factory(v), 3u);
+
+    dll::fs::remove(not_a_binary);
+
+    return boost::report_errors();
+}
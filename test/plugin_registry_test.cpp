@@ -0,0 +1,106 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/plugin_registry.hpp>
+#include <boost/dll/runtime_symbol_info.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstring>
+#include <set>
+#include <string>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+int main(int argc, char* argv[]) {
+    dll::fs::path registry_library;
+    dll::fs::path dependent_library;
+    for (int i = 1; i < argc; ++i) {
+        if (!b2_workarounds::is_shared_library(argv[i])) {
+            continue;
+        }
+
+        if (std::strstr(argv[i], "registry_dependent_library")) {
+            dependent_library = argv[i];
+        } else {
+            registry_library = argv[i];
+        }
+    }
+    BOOST_TEST(!registry_library.empty());
+    BOOST_TEST(!dependent_library.empty());
+
+    dll::shared_library lib(registry_library);
+    const dll::plugin_registry registry(lib);
+    BOOST_TEST(!registry.empty());
+
+    std::set<std::string> names;
+    for (const dll::registry_entry& entry : registry) {
+        names.insert(entry.name);
+        BOOST_TEST_EQ(entry.name_hash, dll::registry_hash(entry.name));
+        BOOST_TEST(lib.has(entry.name));
+    }
+    BOOST_TEST_EQ(names.size(), 3u);
+    BOOST_TEST(names.count("registry_increment"));
+    BOOST_TEST(names.count("registry_name"));
+    BOOST_TEST(names.count("registry_answer"));
+
+    const dll::registry_entry* increment = registry.find("registry_increment");
+    BOOST_TEST(increment);
+    BOOST_TEST(!increment->as<int>());
+    BOOST_TEST(!increment->as<long(int)>());
+    BOOST_TEST(increment->as<int(int)>());
+    BOOST_TEST_EQ(increment->as<int(int)>()(41), 42);
+    BOOST_TEST_EQ(increment->as<int(int)>(), &lib.get_alias<int(int)>("registry_increment"));
+
+    const dll::registry_entry* name = registry.find(std::string("registry_name"));
+    BOOST_TEST(name);
+    BOOST_TEST(name->as<std::string>());
+    BOOST_TEST_EQ(*name->as<std::string>(), "registry_library");
+
+    const dll::registry_entry* answer = registry.find("registry_answer");
+    BOOST_TEST(answer);
+    BOOST_TEST(!answer->as<int>());
+    BOOST_TEST(answer->as<const int>());
+    BOOST_TEST_EQ(*answer->as<const int>(), 42);
+
+    BOOST_TEST(!registry.find("registry_missing"));
+    BOOST_TEST(!registry.find(""));
+
+    // Program has no registered plugins. Depending on the platform it may have no registry at all.
+    dll::shared_library self(dll::program_location());
+    std::error_code ec;
+    dll::plugin_registry self_registry(self, ec);
+    BOOST_TEST(self_registry.empty());
+    if (ec) {
+        BOOST_TEST_THROWS(dll::plugin_registry{self}, dll::fs::system_error);
+    }
+
+    // Library has no registry of its own, registry of its dependency must not be reported.
+    dll::shared_library dependent(dependent_library);
+    BOOST_TEST_EQ(dependent.get<int(int)>("registry_dependent_increment")(1), 2);
+    std::error_code dependent_ec;
+    dll::plugin_registry dependent_registry(dependent, dependent_ec);
+    BOOST_TEST(dependent_ec);
+    BOOST_TEST(dependent_registry.empty());
+    BOOST_TEST_THROWS(dll::plugin_registry{dependent}, dll::fs::system_error);
+
+    std::error_code not_loaded_ec;
+    dll::plugin_registry not_loaded(dll::shared_library(), not_loaded_ec);
+    BOOST_TEST(not_loaded_ec);
+    BOOST_TEST(not_loaded.empty());
+
+    dll::plugin_registry empty;
+    BOOST_TEST(empty.empty());
+    BOOST_TEST(empty.begin() == empty.end());
+    BOOST_TEST(!empty.find("registry_increment"));
+
+    return boost::report_errors();
+}
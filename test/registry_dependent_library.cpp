@@ -0,0 +1,20 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+// Library without a registry that depends on the `registry_library`
+
+#include <boost/config.hpp>
+
+namespace _autoaliases {
+    extern "C" BOOST_SYMBOL_IMPORT const void* registry_increment;
+}
+
+extern "C" BOOST_SYMBOL_EXPORT int registry_dependent_increment(int i) {
+    typedef int(func_t)(int);
+    return reinterpret_cast<func_t*>(const_cast<void*>(_autoaliases::registry_increment))(i);
+}
@@ -0,0 +1,28 @@
+// Copyright Antony Polukhin, 2026.
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+// MinGW related workaround
+#define BOOST_DLL_FORCE_ALIAS_INSTANTIATION
+
+#include <boost/dll/plugin_registry.hpp>
+
+#include <string>
+
+namespace registry {
+    int increment(int i) {
+        return i + 1;
+    }
+
+    std::string name("registry_library");
+
+    const int answer = 42;
+}
+
+BOOST_DLL_REGISTER(registry::increment, registry_increment)
+BOOST_DLL_REGISTER(registry::name, registry_name)
+BOOST_DLL_REGISTER_SECTIONED(registry::answer, registry_answer, regsect)
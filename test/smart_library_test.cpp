@@ -18,6 +18,16 @@
 
 #include <boost/dll/smart_library.hpp>
 
+struct override_class
+{
+    int arr[32];
+};
+
+struct other_class
+{
+    int arr[32];
+};
+
 // Test for smart_library construction from empty/unloaded shared_library objects.
 int main(int argc, char* argv[])
 {
@@ -66,5 +76,40 @@ int main(int argc, char* argv[])
         BOOST_TEST(sm.is_loaded());
     }
 
+    {
+        // Constructors and destructors are cached, the cache is dropped on type alias changes.
+        smart_library sm(pt);
+        sm.add_type_alias<override_class>("some_space::some_class");
+
+        auto ctor = sm.get_constructor<override_class(int)>();
+        auto dtor = sm.get_destructor<override_class>();
+        BOOST_TEST(ctor.has_standard());
+        BOOST_TEST(dtor.has_standard());
+
+        auto ctor_cached = sm.get_constructor<override_class(int)>();
+        BOOST_TEST(ctor_cached.standard == ctor.standard);
+        BOOST_TEST(ctor_cached.allocating == ctor.allocating);
+        BOOST_TEST(sm.get_destructor<override_class>().standard == dtor.standard);
+
+        smart_library copy = sm;
+        BOOST_TEST(copy.get_constructor<override_class(int)>().standard == ctor.standard);
+
+        // Not found results are cached too, until the type alias is added
+        BOOST_TEST(!sm.get_constructor<other_class(int)>().has_standard());
+        BOOST_TEST(!sm.get_destructor<other_class>().has_standard());
+
+        sm.add_type_alias<other_class>("some_space::some_class");
+        BOOST_TEST(sm.get_constructor<other_class(int)>().has_standard());
+        BOOST_TEST(sm.get_destructor<other_class>().has_standard());
+        BOOST_TEST(sm.get_constructor<override_class(int)>().standard == ctor.standard);
+
+        // Copy keeps its own type aliases
+        BOOST_TEST(!copy.get_constructor<other_class(int)>().has_standard());
+        BOOST_TEST(copy.get_destructor<override_class>().standard == dtor.standard);
+
+        sm.unload();
+        BOOST_TEST(!sm.is_loaded());
+    }
+
     return boost::report_errors();
 }
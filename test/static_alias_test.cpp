@@ -0,0 +1,51 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#if defined(BOOST_DLL_STATIC_PLUGINS)
+// Plugin is not seen in this file, it is bound only by the linker
+#   include "../example/tutorial_common/my_plugin_api.hpp"
+#else
+// MinGW related workaround
+#   define BOOST_DLL_FORCE_ALIAS_INSTANTIATION
+// Keeps the plugin in the program, so that it could be found via program_location()
+#   include "../example/tutorial4/static_plugin.hpp"
+#endif
+
+#include <boost/dll/static_alias.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <memory>
+#include <type_traits>
+
+BOOST_DLL_DECLARE_STATIC_ALIAS(std::shared_ptr<my_plugin_api>(), create_plugin)
+
+namespace nested {
+    BOOST_DLL_DECLARE_STATIC_ALIAS(std::shared_ptr<my_plugin_api>(), create_plugin)
+}
+
+// Unit Tests
+
+int main() {
+    auto creator = boost::dll::import_static_alias<_static_aliases::create_plugin>();
+    BOOST_TEST_EQ(std::string(_static_aliases::create_plugin::name()), "create_plugin");
+
+#if defined(BOOST_DLL_STATIC_PLUGINS)
+    BOOST_TEST((std::is_same<decltype(creator), std::shared_ptr<my_plugin_api>(*)()>::value));
+    BOOST_TEST(creator == boost::dll::import_static_alias<nested::_static_aliases::create_plugin>());
+#endif
+
+    std::shared_ptr<my_plugin_api> plugin = creator();
+    BOOST_TEST(plugin);
+    BOOST_TEST_EQ(plugin->name(), "static");
+    BOOST_TEST_EQ(plugin->calculate(5, 2), 3);
+
+    auto nested_creator = boost::dll::import_static_alias<nested::_static_aliases::create_plugin>();
+    BOOST_TEST_EQ(nested_creator()->name(), "static");
+
+    return boost::report_errors();
+}
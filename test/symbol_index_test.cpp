@@ -0,0 +1,127 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/symbol_index.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+static dll::symbol_info make_symbol(const char* name, std::uint64_t address, std::uint64_t size) {
+    dll::symbol_info info;
+    info.name = name;
+    info.address = address;
+    info.size = size;
+    return info;
+}
+
+static void test_synthetic() {
+    std::vector<dll::symbol_info> symbols;
+    symbols.push_back(make_symbol("c", 300, 0));
+    symbols.push_back(make_symbol("a", 100, 50));
+    symbols.push_back(make_symbol("a_alias", 100, 0));
+    symbols.push_back(make_symbol("b", 200, 10));
+    symbols.push_back(make_symbol("zero", 0, 10));
+    symbols.push_back(make_symbol("", 500, 10));
+
+    const dll::symbol_index index(symbols);
+    BOOST_TEST_EQ(index.size(), 3u);
+    BOOST_TEST(!index.empty());
+
+    BOOST_TEST(!index.lookup(0));
+    BOOST_TEST(!index.lookup(99));
+
+    dll::symbol_lookup_result res = index.lookup(100);
+    BOOST_TEST(res);
+    BOOST_TEST_CSTR_EQ(res.name, "a");
+    BOOST_TEST_EQ(res.offset, 0u);
+    BOOST_TEST_EQ(res.size, 50u);
+
+    res = index.lookup(149);
+    BOOST_TEST_CSTR_EQ(res.name, "a");
+    BOOST_TEST_EQ(res.symbol_address, 100u);
+    BOOST_TEST_EQ(res.offset, 49u);
+
+    BOOST_TEST(!index.lookup(150));
+    BOOST_TEST(!index.lookup(210));
+    BOOST_TEST_CSTR_EQ(index.lookup(209).name, "b");
+
+    // Unknown size
+    res = index.lookup(100500);
+    BOOST_TEST_CSTR_EQ(res.name, "c");
+    BOOST_TEST_EQ(res.offset, 100200u);
+
+    std::vector<std::uint64_t> addresses;
+    for (std::uint64_t i = 0; i < 400; i += 3) {
+        addresses.push_back(i);
+        addresses.push_back(i);
+    }
+    const std::vector<dll::symbol_lookup_result> results = index.lookup_sorted(addresses);
+    BOOST_TEST_EQ(results.size(), addresses.size());
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        const dll::symbol_lookup_result expected = index.lookup(addresses[i]);
+        BOOST_TEST_EQ(results[i].name, expected.name);
+        BOOST_TEST_EQ(results[i].offset, expected.offset);
+    }
+
+    const dll::symbol_index empty;
+    BOOST_TEST(empty.empty());
+    BOOST_TEST(!empty.lookup(100));
+    BOOST_TEST(empty.lookup_sorted(addresses).size() == addresses.size());
+}
+
+int main(int argc, char* argv[]) {
+    test_synthetic();
+
+    const dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    dll::library_info info(shared_library_path);
+    const std::vector<dll::symbol_info> symbols = info.symbols_info();
+    const dll::symbol_index index(shared_library_path);
+    BOOST_TEST(!index.empty());
+
+    std::vector<std::uint64_t> addresses;
+    bool say_hello_found = false;
+    for (std::size_t i = 0; i < symbols.size(); ++i) {
+        if (!symbols[i].address) {
+            continue;
+        }
+
+        const dll::symbol_lookup_result res = index.lookup(symbols[i].address);
+        BOOST_TEST(res);
+        BOOST_TEST_EQ(res.symbol_address, symbols[i].address);
+        BOOST_TEST_EQ(res.offset, 0u);
+        addresses.push_back(symbols[i].address);
+
+        if (symbols[i].name == "say_hello") {
+            say_hello_found = (std::strcmp(res.name, "say_hello") == 0);
+            if (symbols[i].size > 1) {
+                BOOST_TEST_CSTR_EQ(index.lookup(symbols[i].address + symbols[i].size - 1).name, "say_hello");
+                BOOST_TEST_EQ(index.lookup(symbols[i].address + 1).offset, 1u);
+                addresses.push_back(symbols[i].address + symbols[i].size - 1);
+            }
+        }
+    }
+    BOOST_TEST(say_hello_found);
+
+    std::sort(addresses.begin(), addresses.end());
+    const std::vector<dll::symbol_lookup_result> results = index.lookup_sorted(addresses);
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        BOOST_TEST(results[i]);
+        BOOST_TEST_EQ(results[i].name, index.lookup(addresses[i]).name);
+    }
+
+    return boost::report_errors();
+}
@@ -173,6 +173,26 @@ int main(int argc, char* argv[]) {
         BOOST_TEST(!ec);
     }
 
+    { // cached locations
+        const boost::dll::fs::path& cached = program_location_cached();
+        BOOST_TEST(cached == program_location());
+        BOOST_TEST_EQ(&cached, &program_location_cached());
+
+        std::error_code ec;
+        make_error_code_dirty();
+        BOOST_TEST_EQ(&cached, &program_location_cached(ec));
+        BOOST_TEST(!ec);
+
+        refresh_program_location();
+        BOOST_TEST(&cached != &program_location_cached());
+        BOOST_TEST(cached == program_location_cached()); // old reference is still valid
+
+        const boost::dll::fs::path& this_line = this_line_location_cached();
+        BOOST_TEST(this_line == this_line_location());
+        BOOST_TEST_EQ(&this_line, &this_line_location_cached(ec));
+        BOOST_TEST(!ec);
+    }
+
     BOOST_TEST(
         lib.get_alias<boost::dll::fs::path()>("module_location_from_itself")() == lib.location()
     );
@@ -0,0 +1,72 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include "../example/b2_workarounds.hpp"
+
+#include <boost/dll/symbolizer.hpp>
+#include <boost/dll/shared_library.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstring>
+
+// Unit Tests
+
+namespace dll = boost::dll;
+
+int main(int argc, char* argv[]) {
+    const dll::fs::path shared_library_path = b2_workarounds::first_lib_from_argv(argc, argv);
+    BOOST_TEST(shared_library_path.string().find("test_library") != std::string::npos);
+
+    dll::shared_library lib(shared_library_path);
+    const char* const say_hello = reinterpret_cast<const char*>(&lib.get<void()>("say_hello"));
+    const char* const increment = reinterpret_cast<const char*>(&lib.get<int(int)>("increment"));
+    const int* const integer = &lib.get<const int>("const_integer_g");
+
+    std::vector<const void*> addresses;
+    addresses.push_back(increment + 1);
+    addresses.push_back(nullptr);
+    addresses.push_back(say_hello);
+    addresses.push_back(integer);
+    addresses.push_back(say_hello + 1);
+    addresses.push_back(increment);
+
+    dll::symbolizer symbolizer;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        const std::vector<dll::symbolized_address> res = symbolizer.symbolize(addresses);
+        BOOST_TEST_EQ(res.size(), addresses.size());
+
+        BOOST_TEST(!res[1].module);
+        BOOST_TEST(!res[1].symbol_name);
+
+        BOOST_TEST(res[0].module);
+        BOOST_TEST(dll::fs::equivalent(res[0].module.path(), shared_library_path));
+        BOOST_TEST(res[0].module == res[2].module);
+        BOOST_TEST(res[0].module == res[3].module);
+
+        BOOST_TEST(res[0].symbol_name && !std::strcmp(res[0].symbol_name, "increment"));
+        BOOST_TEST_EQ(res[0].symbol_offset, 1u);
+        BOOST_TEST(res[5].symbol_name && !std::strcmp(res[5].symbol_name, "increment"));
+        BOOST_TEST_EQ(res[5].symbol_offset, 0u);
+        BOOST_TEST_EQ(res[0].module_offset, res[5].module_offset + 1);
+
+        BOOST_TEST(res[2].symbol_name && !std::strcmp(res[2].symbol_name, "say_hello"));
+        BOOST_TEST(res[4].symbol_name && !std::strcmp(res[4].symbol_name, "say_hello"));
+        BOOST_TEST_EQ(res[2].symbol_name, res[4].symbol_name); // Interned
+        BOOST_TEST(res[3].symbol_name && !std::strcmp(res[3].symbol_name, "const_integer_g"));
+        BOOST_TEST_EQ(res[3].module_offset, reinterpret_cast<std::uintptr_t>(integer) - res[3].module.base_address());
+    }
+
+    // Addresses that belong to the same binary, but not to the symbols
+    dll::symbolized_address res;
+    const void* const self = reinterpret_cast<const void*>(&main);
+    symbolizer.symbolize(&self, 1, &res);
+    BOOST_TEST(res.module);
+    BOOST_TEST(res.module != symbolizer.symbolize(addresses)[0].module);
+
+    return boost::report_errors();
+}
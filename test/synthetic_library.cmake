@@ -0,0 +1,194 @@
+# Copyright Antony Polukhin, 2026
+#
+# Distributed under the Boost Software License, Version 1.0.
+# See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt
+
+# Synthetic shared libraries with many exported symbols for the scale tests and the benchmarks.
+#
+# When included, defines the function that adds a shared library with the source generated at build time:
+#
+#   boost_dll_add_synthetic_library(<target> SYMBOLS <count> [NAMESPACE_SIZE <count>]
+#       [OVERLOADED <count>] [OVERLOADS <count>] [TEMPLATES <count>] [SECTION_SYMBOLS <count>])
+#
+# When run as a script, generates the source:
+#
+#   cmake -DOUTPUT=<file.cpp> -DSYMBOLS=<count> [-D<PARAMETER>=<count>...] -P synthetic_library.cmake
+#
+# Library exports:
+# * SYMBOLS functions: the first half are C functions `int synthetic_c_<i>(int)`, the second half are C++ functions
+#   `int synthetic::ns_<i / NAMESPACE_SIZE>::function_<i>(int)`. NAMESPACE_SIZE is 100 by default.
+# * OVERLOADED functions `int synthetic::overloads::overloaded_<i>(T)` with OVERLOADS overloads each, where T is
+#   `int`, `double`, `long`, `float`, `short`, `char`, `unsigned` and `bool` in that order. OVERLOADS is 4 by default
+#   and at most 8.
+# * TEMPLATES instantiations `int synthetic::templates::holder::constant<I>(int) const` of a member function template.
+# * SECTION_SYMBOLS aliases `synthetic_alias_<i>` of the C functions in the `synthsec` section.
+# * `synthetic::widget` class with constructors, destructor and `int get(int) const`.
+# * `const unsigned synthetic_<parameter>` C variables with the values of the parameters in lower case.
+
+if(NOT CMAKE_SCRIPT_MODE_FILE)
+  set(BOOST_DLL_SYNTHETIC_LIBRARY_SCRIPT "${CMAKE_CURRENT_LIST_FILE}")
+
+  function(boost_dll_add_synthetic_library name)
+    cmake_parse_arguments(synthetic "" "SYMBOLS;NAMESPACE_SIZE;OVERLOADED;OVERLOADS;TEMPLATES;SECTION_SYMBOLS" "" ${ARGN})
+    if(NOT DEFINED synthetic_SYMBOLS)
+      message(FATAL_ERROR "boost_dll_add_synthetic_library(${name}) requires SYMBOLS")
+    endif()
+
+    set(parameters)
+    foreach(parameter SYMBOLS NAMESPACE_SIZE OVERLOADED OVERLOADS TEMPLATES SECTION_SYMBOLS)
+      if(DEFINED synthetic_${parameter})
+        list(APPEND parameters "-D${parameter}=${synthetic_${parameter}}")
+      endif()
+    endforeach()
+
+    set(source "${CMAKE_CURRENT_BINARY_DIR}/${name}.cpp")
+    add_custom_command(
+      OUTPUT "${source}"
+      COMMAND "${CMAKE_COMMAND}" "-DOUTPUT=${source}" ${parameters} -P "${BOOST_DLL_SYNTHETIC_LIBRARY_SCRIPT}"
+      DEPENDS "${BOOST_DLL_SYNTHETIC_LIBRARY_SCRIPT}"
+      COMMENT "Generating synthetic library with ${synthetic_SYMBOLS} symbols"
+      VERBATIM
+    )
+    add_library(${name} SHARED "${source}")
+    target_link_libraries(${name} PRIVATE Boost::dll)
+  endfunction()
+
+  return()
+endif()
+
+if(NOT DEFINED OUTPUT OR NOT DEFINED SYMBOLS)
+  message(FATAL_ERROR "OUTPUT and SYMBOLS must be defined")
+endif()
+
+foreach(parameter NAMESPACE_SIZE:100 OVERLOADED:0 OVERLOADS:4 TEMPLATES:0 SECTION_SYMBOLS:0)
+  string(REPLACE ":" ";" parameter "${parameter}")
+  list(GET parameter 0 parameter_name)
+  list(GET parameter 1 parameter_default)
+  if(NOT DEFINED ${parameter_name})
+    set(${parameter_name} ${parameter_default})
+  endif()
+endforeach()
+
+set(overload_types int double long float short char unsigned bool)
+list(LENGTH overload_types overload_types_count)
+if(OVERLOADS GREATER overload_types_count)
+  message(FATAL_ERROR "OVERLOADS must be at most ${overload_types_count}")
+endif()
+
+math(EXPR c_count "${SYMBOLS} / 2")
+math(EXPR cpp_count "${SYMBOLS} - ${c_count}")
+if(SECTION_SYMBOLS GREATER 0 AND c_count EQUAL 0)
+  message(FATAL_ERROR "SECTION_SYMBOLS require at least 2 SYMBOLS")
+endif()
+
+file(WRITE "${OUTPUT}" "// Generated by synthetic_library.cmake, do not edit
+
+#define BOOST_DLL_FORCE_ALIAS_INSTANTIATION
+#include <boost/config.hpp>
+#include <boost/dll/alias.hpp>
+
+extern \"C\" BOOST_SYMBOL_EXPORT const unsigned synthetic_symbols = ${SYMBOLS}u;
+extern \"C\" BOOST_SYMBOL_EXPORT const unsigned synthetic_namespace_size = ${NAMESPACE_SIZE}u;
+extern \"C\" BOOST_SYMBOL_EXPORT const unsigned synthetic_overloaded = ${OVERLOADED}u;
+extern \"C\" BOOST_SYMBOL_EXPORT const unsigned synthetic_overloads = ${OVERLOADS}u;
+extern \"C\" BOOST_SYMBOL_EXPORT const unsigned synthetic_templates = ${TEMPLATES}u;
+extern \"C\" BOOST_SYMBOL_EXPORT const unsigned synthetic_section_symbols = ${SECTION_SYMBOLS}u;
+
+namespace synthetic {
+
+class BOOST_SYMBOL_EXPORT widget {
+    int value_;
+public:
+    widget();
+    explicit widget(int value);
+    ~widget();
+    int get(int x) const;
+};
+
+widget::widget() : value_(0) {}
+widget::widget(int value) : value_(value) {}
+widget::~widget() {}
+int widget::get(int x) const { return value_ + x; }
+
+namespace templates {
+
+class BOOST_SYMBOL_EXPORT holder {
+public:
+    template <int I>
+    int constant(int x) const { return x + I; }
+};
+
+} // namespace templates
+
+} // namespace synthetic
+
+")
+
+# Writing in chunks keeps the memory and time of the generation linear
+set(content "")
+macro(flush_every_1000 counter)
+  math(EXPR chunk "${counter} % 1000")
+  if(chunk EQUAL 0)
+    file(APPEND "${OUTPUT}" "${content}")
+    set(content "")
+  endif()
+endmacro()
+
+set(i 0)
+while(i LESS c_count)
+  string(APPEND content "extern \"C\" BOOST_SYMBOL_EXPORT int synthetic_c_${i}(int x) { return x + ${i}; }\n")
+  math(EXPR i "${i} + 1")
+  flush_every_1000(${i})
+endwhile()
+
+set(i 0)
+set(namespace_index -1)
+while(i LESS cpp_count)
+  math(EXPR index "${i} / ${NAMESPACE_SIZE}")
+  if(NOT index EQUAL namespace_index)
+    if(namespace_index GREATER -1)
+      string(APPEND content "}} // namespace synthetic::ns_${namespace_index}\n")
+    endif()
+    set(namespace_index ${index})
+    string(APPEND content "\nnamespace synthetic { namespace ns_${index} {\n")
+  endif()
+  string(APPEND content "BOOST_SYMBOL_EXPORT int function_${i}(int x) { return x + ${i}; }\n")
+  math(EXPR i "${i} + 1")
+  flush_every_1000(${i})
+endwhile()
+if(namespace_index GREATER -1)
+  string(APPEND content "}} // namespace synthetic::ns_${namespace_index}\n")
+endif()
+
+string(APPEND content "\nnamespace synthetic { namespace overloads {\n")
+set(i 0)
+while(i LESS OVERLOADED)
+  set(j 0)
+  while(j LESS OVERLOADS)
+    list(GET overload_types ${j} type)
+    string(APPEND content "BOOST_SYMBOL_EXPORT int overloaded_${i}(${type} x) { return static_cast<int>(x) + ${i}; }\n")
+    math(EXPR j "${j} + 1")
+  endwhile()
+  math(EXPR i "${i} + 1")
+  flush_every_1000(${i})
+endwhile()
+string(APPEND content "}} // namespace synthetic::overloads\n")
+
+string(APPEND content "\nnamespace synthetic { namespace templates {\n")
+set(i 0)
+while(i LESS TEMPLATES)
+  string(APPEND content "template int holder::constant<${i}>(int) const;\n")
+  math(EXPR i "${i} + 1")
+  flush_every_1000(${i})
+endwhile()
+string(APPEND content "}} // namespace synthetic::templates\n\n")
+
+set(i 0)
+while(i LESS SECTION_SYMBOLS)
+  math(EXPR function_index "${i} % ${c_count}")
+  string(APPEND content "BOOST_DLL_ALIAS_SECTIONED(synthetic_c_${function_index}, synthetic_alias_${i}, synthsec)\n")
+  math(EXPR i "${i} + 1")
+  flush_every_1000(${i})
+endwhile()
+
+file(APPEND "${OUTPUT}" "${content}")
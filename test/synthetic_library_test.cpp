@@ -0,0 +1,139 @@
+// Copyright Antony Polukhin, 2026
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+// Checks the lookups and the scaling of the symbol tables on the libraries from synthetic_library.cmake.
+
+#include <boost/dll/library_info.hpp>
+#include <boost/dll/shared_library.hpp>
+#include <boost/dll/smart_library.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace dll = boost::dll;
+
+namespace {
+
+struct holder_alias {};
+
+struct measurement {
+    unsigned    symbols;
+    std::size_t exported;
+    double      storage_bytes_per_symbol;
+};
+
+unsigned layout(const dll::shared_library& lib, const char* parameter) {
+    return lib.get<const unsigned>(std::string("synthetic_") + parameter);
+}
+
+measurement check_library(const dll::fs::path& path) {
+    const dll::shared_library lib(path);
+    const unsigned symbols = layout(lib, "symbols");
+    const unsigned namespace_size = layout(lib, "namespace_size");
+    const unsigned overloaded = layout(lib, "overloaded");
+    const unsigned overloads = layout(lib, "overloads");
+    const unsigned templates = layout(lib, "templates");
+    const unsigned section_symbols = layout(lib, "section_symbols");
+    std::cout << "Library: " << path << ", symbols: " << symbols << std::endl;
+
+    const unsigned c_count = symbols / 2;
+    const unsigned cpp_count = symbols - c_count;
+    BOOST_TEST(c_count > 0 && cpp_count > 0 && overloaded > 0 && overloads > 1 && templates > 0 && section_symbols > 0);
+
+    dll::library_info info(path);
+    const std::size_t exported = info.symbols().size();
+    BOOST_TEST_GE(exported, symbols + overloaded * overloads + templates + section_symbols);
+
+    std::vector<std::string> aliases = info.symbols("synthsec");
+    BOOST_TEST_EQ(aliases.size(), section_symbols);
+    std::sort(aliases.begin(), aliases.end());
+    BOOST_TEST(std::binary_search(aliases.begin(), aliases.end(), "synthetic_alias_" + std::to_string(section_symbols - 1)));
+
+    const std::string last_c = "synthetic_c_" + std::to_string(c_count - 1);
+    BOOST_TEST_EQ(lib.get<int(int)>(last_c)(1), static_cast<int>(c_count));
+    BOOST_TEST_EQ((*lib.get<int(*)(int)>("synthetic_alias_0"))(1), 1);
+
+    dll::experimental::smart_library sl(path);
+
+    const unsigned last = cpp_count - 1;
+    const std::string last_function = "synthetic::ns_" + std::to_string(last / namespace_size)
+        + "::function_" + std::to_string(last);
+    BOOST_TEST_EQ(sl.get_function<int(int)>(last_function)(1), static_cast<int>(last + 1));
+    BOOST_TEST_EQ(sl.get_function<int(int)>("synthetic::ns_0::function_0")(1), 1);
+
+    const std::string last_overloaded = "synthetic::overloads::overloaded_" + std::to_string(overloaded - 1);
+    BOOST_TEST_EQ(sl.get_function<int(int)>(last_overloaded)(1), static_cast<int>(overloaded));
+    BOOST_TEST_EQ(sl.get_function<int(double)>(last_overloaded)(1.0), static_cast<int>(overloaded));
+
+    sl.add_type_alias<holder_alias>("synthetic::templates::holder");
+    const std::string last_template = "constant<" + std::to_string(templates - 1) + ">";
+    auto constant = sl.get_mem_fn<const holder_alias, int(int)>(last_template);
+    const holder_alias object{}; // `holder` has no data members
+    BOOST_TEST_EQ((object.*constant)(1), static_cast<int>(templates));
+
+    // Memory of the demangled symbol table
+    std::size_t storage_bytes = 0;
+    for (const auto& e : sl.symbol_storage().get_storage()) {
+        storage_bytes += sizeof(e) + e.mangled.capacity() + e.demangled.capacity();
+    }
+
+    measurement m;
+    m.symbols = symbols;
+    m.exported = exported;
+    m.storage_bytes_per_symbol = static_cast<double>(storage_bytes) / static_cast<double>(sl.symbol_storage().get_storage().size());
+    std::cout << "storage bytes per symbol: " << m.storage_bytes_per_symbol << std::endl;
+    return m;
+}
+
+double parse_ns(const dll::fs::path& path) {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    dll::library_info info(path);
+    const std::size_t exported = info.symbols().size();
+    BOOST_TEST(exported > 0);
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start
+    ).count());
+}
+
+} // namespace
+
+// Unit Tests
+
+int main(int argc, char* argv[]) {
+    BOOST_TEST_EQ(argc, 3);
+    if (argc != 3) {
+        return boost::report_errors();
+    }
+
+    const measurement small = check_library(argv[1]);
+    const measurement large = check_library(argv[2]);
+    BOOST_TEST_LT(small.symbols, large.symbols);
+
+    // Best of the interleaved runs, so that both libraries are measured under the same load of the machine
+    double small_ns = parse_ns(argv[1]);
+    double large_ns = parse_ns(argv[2]);
+    for (int run = 0; run < 20; ++run) {
+        small_ns = (std::min)(small_ns, parse_ns(argv[1]));
+        large_ns = (std::min)(large_ns, parse_ns(argv[2]));
+    }
+    const double small_ns_per_symbol = small_ns / static_cast<double>(small.exported);
+    const double large_ns_per_symbol = large_ns / static_cast<double>(large.exported);
+    std::cout << "parse ns per symbol: " << small_ns_per_symbol << " and " << large_ns_per_symbol << std::endl;
+
+    // Cost per symbol must not grow with the count of symbols. Bounds are loose, to catch only the superlinear
+    // behavior and not the noise.
+    BOOST_TEST_LE(large_ns_per_symbol, small_ns_per_symbol * 5);
+    BOOST_TEST_LE(large.storage_bytes_per_symbol, small.storage_bytes_per_symbol * 2);
+
+    return boost::report_errors();
+}